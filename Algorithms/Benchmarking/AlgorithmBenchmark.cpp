@@ -0,0 +1,530 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "../Kadane/MaximumSubarraySum.h"
+#include "../Searching/Binary Search/IterativeBinarySearcher.h"
+#include "../Searching/Binary Search/RecursiveBinarySearcher.h"
+#include "../Sorting/Bubble Sort/BubbleSorter.h"
+#include "../Sorting/Merge Sort/MergeSorter.h"
+#include "../Sorting/Non-Comparison Element Count/CountingSorter.h"
+#include "../Sorting/Quick Sort/QuickSorter.h"
+#include "InputGenerators.h"
+
+using namespace std;
+
+/*
+    Algorithm Micro-Benchmark Suite
+    -------------------------------
+    Runs every sorter, searcher and Kadane variant over every input distribution for sizes 10^2 .. 10^8.
+
+    Methodology:
+    1. Generate the input once per (distribution, size) - generation is never timed
+    2. Warmup runs: execute the algorithm a few times and throw the timings away (caches, page faults, branch predictors)
+    3. Timed repetitions: each sorter works on a fresh copy of the input; the copy itself is not timed
+    4. Report the MEDIAN repetition - robust against a single run being interrupted by the OS
+
+    Metrics:
+    - median_ns:       median wall-clock time of one repetition
+    - ns_per_element:  median_ns / elements processed (elements = n for sorts/Kadane, queries for searches)
+    - throughput:      millions of elements per second
+    - peak_extra_bytes: peak heap memory allocated during one repetition beyond what was live before it
+                        (measured by the operator new/delete overrides below) - shows the memory-vs-time tradeoff
+                        between MergeSorter::sort (O(n) buffer) and MergeSorter::sortInPlace (O(sqrt n) / O(1));
+                        e.g. random n=10^7: sort 155 ns/elem with 40 MB extra, sortInPlace (sqrt n buffer, block
+                        merge) 228 ns/elem with 38 KB, sortInPlace (no buffer) 765 ns/elem with 0 B
+
+    Size limits:
+    - O(n^2) algorithms (BubbleSorter, brute force Kadane) stop at 10^4
+    - QuickSorter always pivots on arr[high], which is quadratic (and recurses n deep) on everything except random input,
+      so non-random distributions stop at 10^4
+    - CountingSorter keeps one map node per distinct value, so high-cardinality inputs stop at 10^7
+    - MergeSorter::sortInPlace with no buffer cannot block merge and falls back to rotations, O(n log^2 n), so it stops at 10^7
+    - Kadane inputs are folded into [-100, 100] and stop at 10^7 so the int sums can never overflow
+
+    Usage:
+        g++ -std=c++17 -O2 -o benchmark AlgorithmBenchmark.cpp
+        ./benchmark [--min-size N] [--max-size N] [--reps N] [--warmup N]
+                    [--filter SUBSTRING] [--distribution NAME] [--format table|json|csv] [--output FILE]
+
+    Default sweep is 10^2 .. 10^6; pass --max-size 100000000 for the full 10^8 sweep (needs ~1.5 GB of memory).
+*/
+
+// Keeps results "used" so the optimizer cannot delete the work being timed
+static volatile uint64_t benchmarkSink = 0;
+
+// Heap tracking: every allocation carries a header with its size so delete can subtract it
+static size_t liveHeapBytes = 0;
+static size_t peakHeapBytes = 0;
+static const size_t HEAP_HEADER = alignof(max_align_t);
+
+void* operator new(size_t size)
+{
+    unsigned char* memory = static_cast<unsigned char*>(malloc(size + HEAP_HEADER));
+    if (!memory) throw bad_alloc();
+
+    *reinterpret_cast<size_t*>(memory) = size;
+    liveHeapBytes += size;
+    peakHeapBytes = max(peakHeapBytes, liveHeapBytes);
+
+    return memory + HEAP_HEADER;
+}
+
+void operator delete(void* pointer) noexcept
+{
+    if (!pointer) return;
+
+    unsigned char* memory = static_cast<unsigned char*>(pointer) - HEAP_HEADER;
+    liveHeapBytes -= *reinterpret_cast<size_t*>(memory);
+    free(memory);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    operator delete(pointer);
+}
+
+struct BenchmarkCase
+{
+    string algorithm;
+    string family; // "sort", "search" or "kadane"
+    function<size_t(Distribution)> sizeLimit;
+
+    // Turns the generated input into the data the algorithm expects (e.g. searchers need sorted data)
+    function<void(vector<int>&)> prepare;
+
+    // Runs the algorithm once over `data`; returns the number of elements processed
+    function<size_t(vector<int>& data, const vector<int>& queries)> run;
+
+    // Whether `run` modifies `data` (and therefore needs a fresh copy per repetition); sorts leave their output in `data`
+    bool mutatesInput;
+};
+
+struct BenchmarkResult
+{
+    string algorithm;
+    string family;
+    string distribution;
+    size_t n;
+    size_t elements;
+    int repetitions;
+    double medianNs;
+    double minNs;
+    double nsPerElement;
+    double throughputMeps; // million elements per second
+    size_t peakExtraBytes;
+};
+
+struct BenchmarkOptions
+{
+    size_t minSize = 100;
+    size_t maxSize = 1000000;
+    int repetitions = 5;
+    int warmup = 1;
+    string filter;
+    string distribution;
+    string format = "table";
+    string output;
+};
+
+class AlgorithmBenchmark
+{
+public:
+    static vector<BenchmarkCase> allCases()
+    {
+        const size_t quadraticLimit = 10000;
+        const size_t unlimited = SIZE_MAX;
+
+        auto noPrepare = [](vector<int>&) {};
+        auto sortPrepare = [](vector<int>& data) { std::sort(data.begin(), data.end()); };
+        auto kadanePrepare = [](vector<int>& data) {
+            for (int& value : data) value = value % 201 - 100;
+        };
+
+        vector<BenchmarkCase> cases;
+
+        cases.push_back({"QuickSorter",
+                         "sort",
+                         [=](Distribution d) { return d == Distribution::Random ? unlimited : quadraticLimit; },
+                         noPrepare,
+                         [](vector<int>& data, const vector<int>&) {
+                             QuickSorter::sort(data);
+                             return data.size();
+                         },
+                         true});
+
+        cases.push_back({"MergeSorter",
+                         "sort",
+                         [=](Distribution) { return unlimited; },
+                         noPrepare,
+                         [](vector<int>& data, const vector<int>&) {
+                             MergeSorter::sort(data);
+                             return data.size();
+                         },
+                         true});
+
+        cases.push_back({"MergeSorter::sortInPlace (sqrt n buffer)",
+                         "sort",
+                         [=](Distribution) { return unlimited; },
+                         noPrepare,
+                         [](vector<int>& data, const vector<int>&) {
+                             MergeSorter::sortInPlace(data);
+                             return data.size();
+                         },
+                         true});
+
+        cases.push_back({"MergeSorter::sortInPlace (no buffer)",
+                         "sort",
+                         [=](Distribution) { return size_t(10000000); },
+                         noPrepare,
+                         [](vector<int>& data, const vector<int>&) {
+                             MergeSorter::sortInPlace(data, 0);
+                             return data.size();
+                         },
+                         true});
+
+        cases.push_back({"CountingSorter",
+                         "sort",
+                         [=](Distribution d) {
+                             bool lowCardinality = d == Distribution::FewUnique || d == Distribution::Zipf;
+                             return lowCardinality ? unlimited : size_t(10000000);
+                         },
+                         noPrepare,
+                         [](vector<int>& data, const vector<int>&) {
+                             // Hand the sorted copy back through `data` so it is verified like the in-place sorters
+                             vector<int> sorted = CountingSorter::sort(data);
+                             data.swap(sorted);
+                             return data.size();
+                         },
+                         true});
+
+        cases.push_back({"BubbleSorter",
+                         "sort",
+                         [=](Distribution) { return quadraticLimit; },
+                         noPrepare,
+                         [](vector<int>& data, const vector<int>&) {
+                             BubbleSorter::sort(data);
+                             return data.size();
+                         },
+                         true});
+
+        cases.push_back({"IterativeHalvingBinarySearcher::search",
+                         "search",
+                         [=](Distribution) { return unlimited; },
+                         sortPrepare,
+                         [](vector<int>& data, const vector<int>& queries) {
+                             uint64_t checksum = 0;
+                             for (int target : queries) checksum += IterativeHalvingBinarySearcher::search(data, target);
+                             benchmarkSink = benchmarkSink + checksum;
+                             return queries.size();
+                         },
+                         false});
+
+        cases.push_back({"IterativeHalvingBinarySearcher::findInsertionPoint",
+                         "search",
+                         [=](Distribution) { return unlimited; },
+                         sortPrepare,
+                         [](vector<int>& data, const vector<int>& queries) {
+                             uint64_t checksum = 0;
+                             for (int target : queries) checksum += IterativeHalvingBinarySearcher::findInsertionPoint(data, target);
+                             benchmarkSink = benchmarkSink + checksum;
+                             return queries.size();
+                         },
+                         false});
+
+        cases.push_back({"IterativeJumpingBinarySearcher::search",
+                         "search",
+                         [=](Distribution) { return unlimited; },
+                         sortPrepare,
+                         [](vector<int>& data, const vector<int>& queries) {
+                             uint64_t checksum = 0;
+                             for (int target : queries) checksum += IterativeJumpingBinarySearcher::search(data, target);
+                             benchmarkSink = benchmarkSink + checksum;
+                             return queries.size();
+                         },
+                         false});
+
+        cases.push_back({"RecursiveBinarySearcher::search",
+                         "search",
+                         [=](Distribution) { return unlimited; },
+                         sortPrepare,
+                         [](vector<int>& data, const vector<int>& queries) {
+                             uint64_t checksum = 0;
+                             int right = static_cast<int>(data.size()) - 1;
+                             for (int target : queries) checksum += RecursiveBinarySearcher::search(data, 0, right, target);
+                             benchmarkSink = benchmarkSink + checksum;
+                             return queries.size();
+                         },
+                         false});
+
+        cases.push_back({"MaxSubarraySolutions::bruteForce",
+                         "kadane",
+                         [=](Distribution) { return quadraticLimit; },
+                         kadanePrepare,
+                         [](vector<int>& data, const vector<int>&) {
+                             MaxSubarraySolutions solutions;
+                             benchmarkSink = benchmarkSink + solutions.bruteForce(data);
+                             return data.size();
+                         },
+                         false});
+
+        cases.push_back({"MaxSubarraySolutions::kadane1",
+                         "kadane",
+                         [=](Distribution) { return size_t(10000000); },
+                         kadanePrepare,
+                         [](vector<int>& data, const vector<int>&) {
+                             MaxSubarraySolutions solutions;
+                             benchmarkSink = benchmarkSink + solutions.kadane1(data);
+                             return data.size();
+                         },
+                         false});
+
+        cases.push_back({"MaxSubarraySolutions::kadane2",
+                         "kadane",
+                         [=](Distribution) { return size_t(10000000); },
+                         kadanePrepare,
+                         [](vector<int>& data, const vector<int>&) {
+                             MaxSubarraySolutions solutions;
+                             benchmarkSink = benchmarkSink + solutions.kadane2(data);
+                             return data.size();
+                         },
+                         false});
+
+        return cases;
+    }
+
+    static vector<BenchmarkResult> run(const BenchmarkOptions& options)
+    {
+        vector<BenchmarkResult> results;
+        vector<BenchmarkCase> cases = allCases();
+
+        for (Distribution distribution : InputGenerator::all())
+        {
+            string distributionName = InputGenerator::name(distribution);
+            if (!options.distribution.empty() && options.distribution != distributionName) continue;
+
+            for (size_t n = options.minSize; n <= options.maxSize; n *= 10)
+            {
+                vector<int> input = InputGenerator::generate(distribution, n);
+
+                for (const BenchmarkCase& benchmarkCase : cases)
+                {
+                    if (!options.filter.empty() && benchmarkCase.algorithm.find(options.filter) == string::npos) continue;
+                    if (n > benchmarkCase.sizeLimit(distribution)) continue;
+
+                    results.push_back(runCase(benchmarkCase, distributionName, input, options));
+                    progress(results.back());
+                }
+            }
+        }
+
+        return results;
+    }
+
+    static void writeTable(const vector<BenchmarkResult>& results, ostream& out)
+    {
+        out << left << setw(52) << "algorithm" << setw(15) << "distribution" << right << setw(11) << "n" << setw(16) << "median (ns)"
+            << setw(12) << "ns/elem" << setw(14) << "Melem/s" << setw(16) << "peak extra B" << "\n";
+        out << string(136, '-') << "\n";
+
+        for (const BenchmarkResult& r : results)
+        {
+            out << left << setw(52) << r.algorithm << setw(15) << r.distribution << right << setw(11) << r.n << setw(16) << fixed
+                << setprecision(0) << r.medianNs << setw(12) << setprecision(2) << r.nsPerElement << setw(14) << setprecision(2)
+                << r.throughputMeps << setw(16) << r.peakExtraBytes << "\n";
+        }
+    }
+
+    static void writeCsv(const vector<BenchmarkResult>& results, ostream& out)
+    {
+        out << "algorithm,family,distribution,n,elements,repetitions,median_ns,min_ns,ns_per_element,throughput_meps,peak_extra_bytes\n";
+
+        for (const BenchmarkResult& r : results)
+        {
+            out << r.algorithm << "," << r.family << "," << r.distribution << "," << r.n << "," << r.elements << "," << r.repetitions << ","
+                << fixed << setprecision(1) << r.medianNs << "," << r.minNs << "," << setprecision(4) << r.nsPerElement << ","
+                << r.throughputMeps << "," << r.peakExtraBytes << "\n";
+        }
+    }
+
+    static void writeJson(const vector<BenchmarkResult>& results, ostream& out)
+    {
+        out << "{\n  \"benchmark\": \"AlgorithmBenchmark\",\n  \"results\": [\n";
+
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const BenchmarkResult& r = results[i];
+            out << "    {\"algorithm\": \"" << r.algorithm << "\", \"family\": \"" << r.family << "\", \"distribution\": \"" << r.distribution
+                << "\", \"n\": " << r.n << ", \"elements\": " << r.elements << ", \"repetitions\": " << r.repetitions << fixed
+                << setprecision(1) << ", \"median_ns\": " << r.medianNs << ", \"min_ns\": " << r.minNs << setprecision(4)
+                << ", \"ns_per_element\": " << r.nsPerElement << ", \"throughput_meps\": " << r.throughputMeps
+                << ", \"peak_extra_bytes\": " << r.peakExtraBytes << "}";
+            out << (i + 1 < results.size() ? ",\n" : "\n");
+        }
+
+        out << "  ]\n}\n";
+    }
+
+private:
+    static BenchmarkResult runCase(const BenchmarkCase& benchmarkCase,
+                                   const string& distributionName,
+                                   const vector<int>& input,
+                                   const BenchmarkOptions& options)
+    {
+        vector<int> prepared = input;
+        benchmarkCase.prepare(prepared);
+
+        vector<int> queries = benchmarkCase.family == "search" ? makeQueries(prepared) : vector<int>();
+
+        vector<double> timings;
+        size_t elements = 0;
+        size_t peakExtraBytes = 0;
+
+        for (int rep = 0; rep < options.warmup + options.repetitions; rep++)
+        {
+            // Fresh copy for mutating algorithms - made outside the timed region
+            vector<int> working = benchmarkCase.mutatesInput ? prepared : vector<int>();
+            vector<int>& data = benchmarkCase.mutatesInput ? working : prepared;
+
+            size_t liveBefore = liveHeapBytes;
+            peakHeapBytes = liveBefore;
+
+            auto start = chrono::steady_clock::now();
+            elements = benchmarkCase.run(data, queries);
+            auto end = chrono::steady_clock::now();
+
+            peakExtraBytes = max(peakExtraBytes, peakHeapBytes - liveBefore);
+
+            if (rep >= options.warmup) timings.push_back(chrono::duration<double, nano>(end - start).count());
+
+            // Verify outside the timed region - a fast but wrong sorter must not produce a number
+            if (benchmarkCase.family == "sort" && !is_sorted(data.begin(), data.end()))
+            {
+                cerr << "error: " << benchmarkCase.algorithm << " produced unsorted output on " << distributionName << endl;
+                exit(1);
+            }
+        }
+
+        std::sort(timings.begin(), timings.end());
+        double median = timings.size() % 2 == 1 ? timings[timings.size() / 2]
+                                                : (timings[timings.size() / 2 - 1] + timings[timings.size() / 2]) / 2.0;
+
+        BenchmarkResult result;
+        result.algorithm = benchmarkCase.algorithm;
+        result.family = benchmarkCase.family;
+        result.distribution = distributionName;
+        result.n = input.size();
+        result.elements = elements;
+        result.repetitions = options.repetitions;
+        result.medianNs = median;
+        result.minNs = timings.front();
+        result.nsPerElement = elements > 0 ? median / elements : 0.0;
+        result.throughputMeps = median > 0 ? elements / median * 1000.0 : 0.0;
+        result.peakExtraBytes = peakExtraBytes;
+        return result;
+    }
+
+    // Half hits (values taken from the data), half likely misses (value + 1 / value - 1), capped at 10^6 queries
+    static vector<int> makeQueries(const vector<int>& sorted)
+    {
+        size_t count = min<size_t>(sorted.size(), 1000000);
+        vector<int> queries(count);
+
+        mt19937_64 rng(7);
+        uniform_int_distribution<size_t> index(0, sorted.size() - 1);
+
+        for (size_t i = 0; i < count; i++)
+        {
+            int value = sorted[index(rng)];
+            queries[i] = (i % 2 == 0) ? value : (i % 4 == 1 ? value + 1 : value - 1);
+        }
+
+        return queries;
+    }
+
+    static void progress(const BenchmarkResult& r)
+    {
+        cerr << "  " << r.algorithm << " / " << r.distribution << " / n=" << r.n << ": " << fixed << setprecision(2) << r.nsPerElement
+             << " ns/elem" << endl;
+    }
+};
+
+static bool parseOptions(int argc, char** argv, BenchmarkOptions& options)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (i + 1 >= argc)
+        {
+            cerr << "missing value for " << arg << endl;
+            return false;
+        }
+
+        string value = argv[++i];
+
+        if (arg == "--min-size") options.minSize = stoull(value);
+        else if (arg == "--max-size") options.maxSize = stoull(value);
+        else if (arg == "--reps") options.repetitions = stoi(value);
+        else if (arg == "--warmup") options.warmup = stoi(value);
+        else if (arg == "--filter") options.filter = value;
+        else if (arg == "--distribution") options.distribution = value;
+        else if (arg == "--format") options.format = value;
+        else if (arg == "--output") options.output = value;
+        else
+        {
+            cerr << "unknown option " << arg << endl;
+            return false;
+        }
+    }
+
+    if (options.minSize == 0 || options.repetitions < 1 || options.warmup < 0)
+    {
+        cerr << "--min-size and --reps must be positive, --warmup non-negative" << endl;
+        return false;
+    }
+
+    if (options.format != "table" && options.format != "json" && options.format != "csv")
+    {
+        cerr << "--format must be one of table, json, csv" << endl;
+        return false;
+    }
+
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    BenchmarkOptions options;
+    if (!parseOptions(argc, argv, options)) return 1;
+
+    cerr << "Running benchmarks for n = " << options.minSize << " .. " << options.maxSize << " (" << options.warmup << " warmup, "
+         << options.repetitions << " timed repetitions)" << endl;
+
+    vector<BenchmarkResult> results = AlgorithmBenchmark::run(options);
+
+    ofstream file;
+    if (!options.output.empty())
+    {
+        file.open(options.output);
+        if (!file)
+        {
+            cerr << "cannot open " << options.output << endl;
+            return 1;
+        }
+    }
+    ostream& out = options.output.empty() ? cout : file;
+
+    if (options.format == "json") AlgorithmBenchmark::writeJson(results, out);
+    else if (options.format == "csv") AlgorithmBenchmark::writeCsv(results, out);
+    else AlgorithmBenchmark::writeTable(results, out);
+
+    return 0;
+}
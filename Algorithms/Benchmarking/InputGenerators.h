@@ -0,0 +1,149 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/*
+    Input Distributions for Benchmarking:
+    - Sorting and searching costs depend as much on the *shape* of the input as on its size
+    - Each distribution below stresses a different weakness:
+        * Sorted / Reverse:   worst case for naive pivot choices (QuickSorter picks arr[high])
+        * Organ Pipe:         ascending then descending - defeats "check if already sorted" shortcuts
+        * Few Unique:         heavy duplicates - stresses partition schemes that send equal keys one way
+        * Zipf:               skewed real-world frequencies (word counts, request keys)
+        * Nearly Sorted:      sorted with ~1% random swaps - rewards adaptive algorithms
+        * Random:             uniform values - the "average case" in textbook analysis
+
+    All generators are deterministic for a given seed so runs can be compared across commits.
+*/
+
+enum class Distribution
+{
+    Sorted,
+    Reverse,
+    OrganPipe,
+    FewUnique,
+    Zipf,
+    NearlySorted,
+    Random
+};
+
+class InputGenerator
+{
+public:
+    static const vector<Distribution>& all()
+    {
+        static const vector<Distribution> distributions = {Distribution::Sorted,
+                                                           Distribution::Reverse,
+                                                           Distribution::OrganPipe,
+                                                           Distribution::FewUnique,
+                                                           Distribution::Zipf,
+                                                           Distribution::NearlySorted,
+                                                           Distribution::Random};
+        return distributions;
+    }
+
+    static string name(Distribution distribution)
+    {
+        switch (distribution)
+        {
+            case Distribution::Sorted:
+                return "sorted";
+            case Distribution::Reverse:
+                return "reverse";
+            case Distribution::OrganPipe:
+                return "organ-pipe";
+            case Distribution::FewUnique:
+                return "few-unique";
+            case Distribution::Zipf:
+                return "zipf";
+            case Distribution::NearlySorted:
+                return "nearly-sorted";
+            case Distribution::Random:
+                return "random";
+        }
+        return "unknown";
+    }
+
+    static vector<int> generate(Distribution distribution, size_t n, uint64_t seed = 42)
+    {
+        mt19937_64 rng(seed);
+        vector<int> arr(n);
+
+        switch (distribution)
+        {
+            case Distribution::Sorted:
+                for (size_t i = 0; i < n; i++) arr[i] = static_cast<int>(i);
+                break;
+
+            case Distribution::Reverse:
+                for (size_t i = 0; i < n; i++) arr[i] = static_cast<int>(n - i);
+                break;
+
+            case Distribution::OrganPipe:
+                // 0, 1, 2, ..., n/2, ..., 2, 1, 0
+                for (size_t i = 0; i < n; i++) arr[i] = static_cast<int>(min(i, n - 1 - i));
+                break;
+
+            case Distribution::FewUnique: {
+                uniform_int_distribution<int> values(0, 15);
+                for (size_t i = 0; i < n; i++) arr[i] = values(rng);
+                break;
+            }
+
+            case Distribution::Zipf:
+                fillZipf(arr, rng);
+                break;
+
+            case Distribution::NearlySorted: {
+                for (size_t i = 0; i < n; i++) arr[i] = static_cast<int>(i);
+                if (n < 2) break;
+
+                uniform_int_distribution<size_t> index(0, n - 1);
+                size_t swaps = max<size_t>(1, n / 100);
+                for (size_t s = 0; s < swaps; s++) swap(arr[index(rng)], arr[index(rng)]);
+                break;
+            }
+
+            case Distribution::Random: {
+                uniform_int_distribution<int> values(0, n > 0 ? static_cast<int>(min<size_t>(n, INT32_MAX)) : 0);
+                for (size_t i = 0; i < n; i++) arr[i] = values(rng);
+                break;
+            }
+        }
+
+        return arr;
+    }
+
+private:
+    /*
+        Zipf(s = 1) over ranks 1..k: P(rank r) is proportional to 1/r
+        - Sample by inverting the cumulative distribution with a binary search
+        - k is capped so the CDF table stays small even for n = 10^8
+    */
+    static void fillZipf(vector<int>& arr, mt19937_64& rng)
+    {
+        size_t k = max<size_t>(1, min<size_t>(arr.size(), 1000000));
+
+        vector<double> cdf(k);
+        double total = 0.0;
+        for (size_t r = 0; r < k; r++)
+        {
+            total += 1.0 / static_cast<double>(r + 1);
+            cdf[r] = total;
+        }
+
+        uniform_real_distribution<double> uniform(0.0, total);
+        for (int& value : arr)
+        {
+            size_t rank = upper_bound(cdf.begin(), cdf.end(), uniform(rng)) - cdf.begin();
+            value = static_cast<int>(min(rank, k - 1));
+        }
+    }
+};
@@ -0,0 +1,148 @@
+// Turn the INSTRUMENT_* hooks on for every algorithm header included below
+#define ALGORITHMS_INSTRUMENTATION
+
+#include <algorithm>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../Benchmarking/InputGenerators.h"
+#include "../Searching/Binary Search/IterativeBinarySearcher.h"
+#include "../Searching/Binary Search/RecursiveBinarySearcher.h"
+#include "../Sorting/Bubble Sort/BubbleSorter.h"
+#include "../Sorting/Merge Sort/MergeSorter.h"
+#include "../Sorting/Quick Sort/QuickSorter.h"
+#include "Instrumentation.h"
+#include "PerfCounters.h"
+
+using namespace std;
+
+/*
+    Algorithm Profiler
+    ------------------
+    Explains WHY an algorithm is slow on a given input by reporting, per algorithm and per input distribution:
+    - operation counts from the INSTRUMENT_* hooks (comparisons, swaps/moves, recursion depth, partition balance)
+    - hardware counters from perf_event_open around each sort/search call (cycles, instructions, branch misses, LLC misses)
+
+    Example reading: QuickSorter on "sorted" input shows depth == n and balance 0.00 -> every pivot is the maximum.
+
+    Usage:
+        g++ -std=c++17 -O2 -o profiler AlgorithmProfiler.cpp
+        ./profiler [n]          (default n = 10000)
+
+    Hardware columns print "n/a" when the kernel does not expose the PMU (see PerfCounters.h).
+*/
+
+struct ProfileCase
+{
+    string algorithm;
+    bool isSearch;
+    function<void(vector<int>& data, const vector<int>& queries)> run;
+};
+
+class AlgorithmProfiler
+{
+public:
+    static vector<ProfileCase> allCases()
+    {
+        return {
+            {"QuickSorter", false, [](vector<int>& data, const vector<int>&) { QuickSorter::sort(data); }},
+            {"MergeSorter", false, [](vector<int>& data, const vector<int>&) { MergeSorter::sort(data); }},
+            {"BubbleSorter", false, [](vector<int>& data, const vector<int>&) { BubbleSorter::sort(data); }},
+            {"std::sort (reference)",
+             false,
+             [](vector<int>& data, const vector<int>&) { std::sort(data.begin(), data.end(), CountingComparator<less<int>>()); }},
+            {"IterativeHalvingBinarySearcher::search",
+             true,
+             [](vector<int>& data, const vector<int>& queries) {
+                 for (int target : queries) IterativeHalvingBinarySearcher::search(data, target);
+             }},
+            {"IterativeJumpingBinarySearcher::search",
+             true,
+             [](vector<int>& data, const vector<int>& queries) {
+                 for (int target : queries) IterativeJumpingBinarySearcher::search(data, target);
+             }},
+            {"RecursiveBinarySearcher::search",
+             true,
+             [](vector<int>& data, const vector<int>& queries) {
+                 int right = static_cast<int>(data.size()) - 1;
+                 for (int target : queries) RecursiveBinarySearcher::search(data, 0, right, target);
+             }},
+        };
+    }
+
+    static void run(size_t n)
+    {
+        PerfCounterGroup perf;
+        if (!perf.available()) cout << "Hardware counters unavailable (perf_event_paranoid / container) - reporting operation counts only\n";
+
+        printHeader();
+
+        for (const ProfileCase& profileCase : allCases())
+        {
+            for (Distribution distribution : InputGenerator::all())
+            {
+                vector<int> data = InputGenerator::generate(distribution, n);
+                vector<int> queries;
+
+                if (profileCase.isSearch)
+                {
+                    std::sort(data.begin(), data.end());
+                    queries = data; // one successful lookup per element
+                }
+
+                Instrumentation::reset();
+                perf.start();
+                profileCase.run(data, queries);
+                PerfReading reading = perf.stop();
+
+                printRow(profileCase.algorithm, InputGenerator::name(distribution), Instrumentation::counters(), reading);
+            }
+            cout << "\n";
+        }
+    }
+
+private:
+    static void printHeader()
+    {
+        cout << left << setw(40) << "algorithm" << setw(15) << "distribution" << right << setw(13) << "comparisons" << setw(12) << "swaps"
+             << setw(12) << "moves" << setw(8) << "depth" << setw(9) << "balance" << setw(14) << "cycles" << setw(7) << "IPC" << setw(12)
+             << "br-miss" << setw(12) << "llc-miss" << "\n";
+        cout << string(154, '-') << "\n";
+    }
+
+    static void printRow(const string& algorithm, const string& distribution, const AlgorithmCounters& c, const PerfReading& reading)
+    {
+        cout << left << setw(40) << algorithm << setw(15) << distribution << right << setw(13) << c.comparisons << setw(12) << c.swaps
+             << setw(12) << c.moves << setw(8) << c.maxRecursionDepth << setw(9) << fixed << setprecision(2);
+
+        if (c.partitions > 0) cout << c.averagePartitionBalance();
+        else cout << "-";
+
+        if (reading.valid)
+        {
+            cout << setw(14) << reading.cycles << setw(7) << reading.instructionsPerCycle() << setw(12) << reading.branchMisses << setw(12)
+                 << reading.llcMisses;
+        }
+        else
+        {
+            cout << setw(14) << "n/a" << setw(7) << "n/a" << setw(12) << "n/a" << setw(12) << "n/a";
+        }
+
+        cout << "\n";
+    }
+};
+
+int main(int argc, char** argv)
+{
+    size_t n = argc > 1 ? stoull(argv[1]) : 10000;
+
+    cout << "Algorithm Profiler (n = " << n << ")\n";
+    cout << "==============================\n";
+
+    AlgorithmProfiler::run(n);
+
+    return 0;
+}
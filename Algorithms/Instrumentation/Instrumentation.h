@@ -0,0 +1,124 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+
+using namespace std;
+
+/*
+    Algorithm Instrumentation Hooks
+    -------------------------------
+    Counts the abstract operations an algorithm performs so slow runs can be explained, not just measured:
+    - comparisons:       element comparisons (for searchers: probes into the array; for the SIMD merge kernels:
+                         every lane of every min/max compare-exchange)
+    - swaps / moves:     element exchanges (QuickSorter, BubbleSorter) and element copies (MergeSorter)
+    - recursion depth:   deepest active call chain - QuickSorter on sorted input reaches depth n
+    - partition balance: min(left, right) / (size - 1) per partition - 0.5 is a perfect split, 0.0 is the worst case
+
+    Opt-in and zero overhead when disabled:
+    - Compile with -DALGORITHMS_INSTRUMENTATION (or #define it before the first include) to turn the hooks on
+    - Otherwise every INSTRUMENT_* macro expands to nothing, so the algorithms compile to exactly the same code as before
+
+    Counters are thread_local: each thread profiles the algorithm calls it makes.
+*/
+
+struct AlgorithmCounters
+{
+    uint64_t comparisons = 0;
+    uint64_t swaps = 0;
+    uint64_t moves = 0;
+    uint64_t maxRecursionDepth = 0;
+    uint64_t partitions = 0;
+    uint64_t unbalancedPartitions = 0; // smaller side got less than 10% of the elements
+    double partitionBalanceSum = 0.0;
+    uint64_t currentRecursionDepth = 0;
+
+    double averagePartitionBalance() const
+    {
+        return partitions > 0 ? partitionBalanceSum / partitions : 0.0;
+    }
+};
+
+class Instrumentation
+{
+public:
+    static AlgorithmCounters& counters()
+    {
+        static thread_local AlgorithmCounters current;
+        return current;
+    }
+
+    static void reset()
+    {
+        counters() = AlgorithmCounters();
+    }
+
+    static void recordPartition(int low, int pivot, int high)
+    {
+        AlgorithmCounters& c = counters();
+        int size = high - low + 1;
+        if (size < 2) return;
+
+        int smaller = min(pivot - low, high - pivot);
+        double balance = static_cast<double>(smaller) / (size - 1);
+
+        c.partitions++;
+        c.partitionBalanceSum += balance;
+        if (balance < 0.1) c.unbalancedPartitions++;
+    }
+
+    // RAII guard: one per recursive call, tracks the deepest nesting seen
+    class RecursionScope
+    {
+    public:
+        RecursionScope()
+        {
+            AlgorithmCounters& c = counters();
+            c.currentRecursionDepth++;
+            c.maxRecursionDepth = max(c.maxRecursionDepth, c.currentRecursionDepth);
+        }
+
+        ~RecursionScope()
+        {
+            counters().currentRecursionDepth--;
+        }
+    };
+};
+
+/*
+    Counting comparator wrapper
+    - Wraps any comparator and counts every call, e.g. std::sort(begin, end, CountingComparator<less<int>>())
+    - Used by the profiler to get reference counts for standard library algorithms
+*/
+template <typename Compare>
+struct CountingComparator
+{
+    Compare compare;
+
+    template <typename T>
+    bool operator()(const T& a, const T& b) const
+    {
+        Instrumentation::counters().comparisons++;
+        return compare(a, b);
+    }
+};
+
+#ifdef ALGORITHMS_INSTRUMENTATION
+
+#define INSTRUMENT_COMPARISON() (Instrumentation::counters().comparisons++)
+#define INSTRUMENT_COMPARISONS(count) (Instrumentation::counters().comparisons += (count))
+#define INSTRUMENT_SWAP() (Instrumentation::counters().swaps++)
+#define INSTRUMENT_MOVES(count) (Instrumentation::counters().moves += (count))
+#define INSTRUMENT_RECURSION_SCOPE() Instrumentation::RecursionScope instrumentationRecursionScope
+#define INSTRUMENT_PARTITION(low, pivot, high) Instrumentation::recordPartition((low), (pivot), (high))
+
+#else
+
+#define INSTRUMENT_COMPARISON() ((void)0)
+#define INSTRUMENT_COMPARISONS(count) ((void)0)
+#define INSTRUMENT_SWAP() ((void)0)
+#define INSTRUMENT_MOVES(count) ((void)0)
+#define INSTRUMENT_RECURSION_SCOPE() ((void)0)
+#define INSTRUMENT_PARTITION(low, pivot, high) ((void)0)
+
+#endif
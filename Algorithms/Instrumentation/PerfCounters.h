@@ -0,0 +1,161 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+
+/*
+    Hardware Performance Counters (Linux perf_event_open)
+    ----------------------------------------------------
+    Operation counts say WHAT an algorithm did; hardware counters say what it cost the CPU:
+    - cycles:         total time in CPU clock ticks
+    - instructions:   retired instructions - instructions / cycles (IPC) shows how well the core is kept busy
+    - branch misses:  mispredicted branches, ~15-20 cycles each (e.g. `arr[j] <= pivot` on random data)
+    - LLC misses:     last-level cache read misses - each one is a trip to DRAM (~100 ns)
+
+    All four counters are opened as ONE group so they are scheduled onto the PMU together and
+    describe exactly the same interval.
+
+    Usage:
+        PerfCounterGroup perf;
+        perf.start();
+        QuickSorter::sort(arr);
+        PerfReading reading = perf.stop();
+
+    Availability:
+    - Needs /proc/sys/kernel/perf_event_paranoid <= 2 (or CAP_PERFMON); containers and VMs often hide the PMU
+    - When the counters cannot be opened, available() is false and every reading reports valid = false
+    - On non-Linux platforms the class compiles to a stub that is never available
+*/
+
+struct PerfReading
+{
+    bool valid = false;
+    uint64_t cycles = 0;
+    uint64_t instructions = 0;
+    uint64_t branchMisses = 0;
+    uint64_t llcMisses = 0;
+
+    double instructionsPerCycle() const
+    {
+        return cycles > 0 ? static_cast<double>(instructions) / cycles : 0.0;
+    }
+};
+
+class PerfCounterGroup
+{
+public:
+    PerfCounterGroup()
+    {
+#ifdef __linux__
+        const uint64_t llcReadMiss = PERF_COUNT_HW_CACHE_LL | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+
+        leader = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES, -1);
+        if (leader < 0) return;
+
+        fds[0] = leader;
+        fds[1] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS, leader);
+        fds[2] = open(PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES, leader);
+        fds[3] = open(PERF_TYPE_HW_CACHE, llcReadMiss, leader);
+
+        for (int fd : fds)
+        {
+            if (fd < 0)
+            {
+                closeAll();
+                return;
+            }
+        }
+#endif
+    }
+
+    ~PerfCounterGroup()
+    {
+        closeAll();
+    }
+
+    PerfCounterGroup(const PerfCounterGroup&) = delete;
+    PerfCounterGroup& operator=(const PerfCounterGroup&) = delete;
+
+    bool available() const
+    {
+        return leader >= 0;
+    }
+
+    void start()
+    {
+#ifdef __linux__
+        if (!available()) return;
+
+        ioctl(leader, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(leader, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+    }
+
+    PerfReading stop()
+    {
+        PerfReading reading;
+
+#ifdef __linux__
+        if (!available()) return reading;
+
+        ioctl(leader, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+        // PERF_FORMAT_GROUP layout: { nr, values[nr] }
+        uint64_t buffer[1 + COUNTER_COUNT] = {};
+        if (read(leader, buffer, sizeof(buffer)) != static_cast<ssize_t>(sizeof(buffer)) || buffer[0] != COUNTER_COUNT) return reading;
+
+        reading.valid = true;
+        reading.cycles = buffer[1];
+        reading.instructions = buffer[2];
+        reading.branchMisses = buffer[3];
+        reading.llcMisses = buffer[4];
+#endif
+
+        return reading;
+    }
+
+private:
+    static const int COUNTER_COUNT = 4;
+
+    int leader = -1;
+    int fds[COUNTER_COUNT] = {-1, -1, -1, -1};
+
+#ifdef __linux__
+    static int open(uint32_t type, uint64_t config, int groupLeader)
+    {
+        perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        attr.disabled = groupLeader < 0 ? 1 : 0; // only the leader starts disabled; members follow it
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_GROUP;
+
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, groupLeader, 0));
+    }
+#endif
+
+    void closeAll()
+    {
+#ifdef __linux__
+        for (int& fd : fds)
+        {
+            if (fd >= 0 && fd != leader) close(fd);
+            fd = -1;
+        }
+        if (leader >= 0) close(leader);
+#endif
+        leader = -1;
+    }
+};
@@ -0,0 +1,239 @@
+#pragma once
+
+#include <algorithm>
+#include <climits>
+#include <deque>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../Prefix Sum/PrefixScanner.h"
+
+using namespace std;
+
+class MaxSubarraySolutions
+{
+private:
+    void printArray(const vector<int>& nums)
+    {
+        /*
+            Stream Insertion Operator: `<<`
+            When used with streams (like `cout`), it becomes the insertion operator. "Inserting" data into the stream.
+            Can be thought of as an arrow showing the direction of the data flow.
+
+            The context determines which behavior you get:
+                - With numbers in arithmetic expressions: bitwise shift
+                    ```
+                    int x = 5;          // Binary: 0101
+                    int result = x << 1; // Binary: 1010 (value: 10)
+                    ```
+                - With streams (cout, ofstream, etc.): stream insertion
+        */
+        cout << "Array: [";
+
+        /*
+            size_t = An unsigned integer type in C/C++ that's specifically designed to represent sizes and counts
+
+            1. Guaranteed to be big enough to hold the size of the largest possible object
+                - able to represent the maximum size of any object that can be allocated in memory
+            2. The "Guaranteed" size varies by platform
+                - 32-bit system = 32 bits (4 bytes)
+                - 64-bit system = 64 bits (8 bytes)
+            3. Commonly used for array indexing & loop counting
+            4. Unsigned, hence, cannot be negative
+        */
+        for (size_t i = 0; i < nums.size(); i++)
+        {
+            cout << nums[i];
+
+            if (i < nums.size() - 1) cout << ", ";
+        }
+
+        cout << "]" << endl;
+    }
+
+public:
+    /*
+        Reason for using `int` instead of `size_t` for array indexing:
+
+        While `size_t` is technically the correct choice, using `int` is often more common in algorithm solutions because:
+            1. Problem constraints usually guarantee array size fits in `int`
+            2. Some algorithms may need negative indices/comparisons
+            3. It's more concise
+
+        Best practices:
+            - Use `size_t` for general purpose array traversal and size management
+            - Use `int` when working with algorithms that may require negative numbers
+                OR when problem constraints guarantee int size is sufficient
+        */
+
+    // Solution 1: Brute Force O(n^2)
+    int bruteForce(vector<int>& nums)
+    {
+        int maxSum = INT_MIN;
+
+        for (int i = 0; i < nums.size(); i++)
+        {
+            int currentSum = 0;
+
+            for (int j = i; j < nums.size(); j++)
+            {
+                currentSum += nums[j];
+                maxSum = max(maxSum, currentSum);
+            }
+        }
+
+        return maxSum;
+    }
+
+    // Solution 2: Original Kadane's from CPHB textbook (allows empty subarray)
+    // Works:  [1,-2,3,4] -> 7, [-1,2,3] -> 5, [1,2,3] -> 6
+    // FAILS:  [-2,-1,-3] -> returns 0 (wrong) instead of -1 (correct)
+    int kadane1(vector<int>& nums)
+    {
+        int maxSum = 0;
+        int sum = 0;
+
+        for (int i = 0; i < nums.size(); i++)
+        {
+            sum = max(nums[i], (nums[i] + sum));
+            maxSum = max(maxSum, sum);
+        }
+        return maxSum;
+    }
+
+    // Solution 3: Modified Kadane's (handles ALL cases)
+    // Original solution from CPHB assumes "that an empty subarray is allowed, so the maximum subarray sum is always at least 0"
+    // This version works correctly for:
+    // [1,-2,3,4]  -> 7        (mixed numbers)
+    // [1,2,3]     -> 6        (all positive)
+    // [-2,-1,-3]  -> -1       (all negative)
+    int kadane2(vector<int>& nums)
+    {
+        int maxSum = nums[0];
+        int sum = nums[0];
+
+        for (int i = 1; i < nums.size(); i++)
+        {
+            sum = max(nums[i], sum + nums[i]);
+            maxSum = max(maxSum, sum);
+        }
+        return maxSum;
+    }
+
+    /*
+        Prefix sums: P[0] = 0, P[i + 1] = nums[0] + ... + nums[i]   (n + 1 entries, long long - no overflow)
+        - sum(nums[i..j]) = P[j + 1] - P[i]
+        - Built with PrefixScanner (SIMD exclusive scan): each entry is the sum of everything before it
+    */
+    vector<long long> prefixSums(const vector<int>& nums)
+    {
+        vector<long long> prefix(nums.size() + 1, 0);
+        for (size_t i = 0; i < nums.size(); i++) prefix[i] = nums[i];
+
+        prefix[nums.size()] = PrefixScanner::exclusiveScan(prefix.data(), prefix.data(), nums.size());
+        return prefix;
+    }
+
+    // Solution 4: Prefix-sum Kadane's O(n)
+    // Best subarray ending at j = P[j + 1] - (smallest P[i] with i <= j)
+    // Returns long long like the prefix sums: {INT_MAX, INT_MAX} sums to more than an int holds
+    // Empty array: LLONG_MIN (no subarray)
+    long long prefixSumKadane(vector<int>& nums)
+    {
+        if (nums.empty()) return LLONG_MIN;
+
+        return maxSubarrayInRange(prefixSums(nums), 0, static_cast<int>(nums.size()) - 1);
+    }
+
+    // Range variant: best subarray inside nums[left..right], answered from precomputed prefix sums in O(right - left)
+    // (build the prefix sums once, then answer many range queries without touching nums)
+    // Throws out_of_range unless 0 <= left <= right < n (prefix holds n + 1 entries)
+    long long maxSubarrayInRange(const vector<long long>& prefix, int left, int right)
+    {
+        if (left < 0 || left > right || static_cast<size_t>(right) + 1 >= prefix.size())
+        {
+            throw out_of_range("maxSubarrayInRange: range [" + to_string(left) + ", " + to_string(right) +
+                               "] outside an array of " + to_string(prefix.empty() ? 0 : prefix.size() - 1));
+        }
+
+        long long smallestPrefix = prefix[left];
+        long long maxSum = LLONG_MIN;
+
+        for (int j = left; j <= right; j++)
+        {
+            maxSum = max(maxSum, prefix[j + 1] - smallestPrefix);
+            smallestPrefix = min(smallestPrefix, prefix[j + 1]);
+        }
+        return maxSum;
+    }
+
+    // Windowed variant: best subarray of length at most k, O(n)
+    // The smallest P[i] over the sliding window j + 1 - k <= i <= j comes from a monotonic deque of indices
+    // Throws invalid_argument for k <= 0 (no subarray fits); an empty array gives LLONG_MIN like prefixSumKadane
+    long long maxSubarrayWithinWindow(vector<int>& nums, int k)
+    {
+        if (k <= 0) throw invalid_argument("maxSubarrayWithinWindow: window length must be positive, got " + to_string(k));
+        if (nums.empty()) return LLONG_MIN;
+
+        vector<long long> prefix = prefixSums(nums);
+        deque<int> candidates; // indices i with increasing prefix[i]
+        long long maxSum = LLONG_MIN;
+        int n = static_cast<int>(nums.size());
+
+        for (int j = 0; j < n; j++)
+        {
+            while (!candidates.empty() && prefix[candidates.back()] >= prefix[j]) candidates.pop_back();
+            candidates.push_back(j);
+            if (candidates.front() < j + 1 - k) candidates.pop_front();
+
+            maxSum = max(maxSum, prefix[j + 1] - prefix[candidates.front()]);
+        }
+        return maxSum;
+    }
+
+public:
+    // Test all solutions
+    void testAllSolutions(vector<int>& nums)
+    {
+        cout << "\nMaximum Subarray Problem" << endl;
+        cout << "------------------------" << endl;
+        printArray(nums);
+
+        cout << "\nResults:" << endl;
+        cout << "1. Brute Force: " << bruteForce(nums) << endl;
+        cout << "   Time Complexity: O(n^2)" << endl;
+
+        cout << "\n2. Original Kadane's (allows empty subarray): " << kadane1(nums) << endl;
+        cout << "   Time Complexity: O(n)" << endl;
+        cout << "   Note: Will return 0 for all-negative arrays" << endl;
+
+        cout << "\n3. Modified Kadane's (handles ALL cases): " << kadane2(nums) << endl;
+        cout << "   Time Complexity: O(n)" << endl;
+        cout << "   Note: Correctly handles all-negative arrays" << endl;
+
+        cout << "\n4. Prefix-sum Kadane's: " << prefixSumKadane(nums) << endl;
+        cout << "   Time Complexity: O(n)" << endl;
+        cout << "   Note: Prefix sums also answer range and windowed variants" << endl;
+
+        if (!nums.empty())
+        {
+            vector<long long> prefix = prefixSums(nums);
+            int half = static_cast<int>(nums.size()) / 2;
+
+            cout << "   Best in first half [0.." << half << "]: " << maxSubarrayInRange(prefix, 0, half) << endl;
+            cout << "   Best with length <= 3: " << maxSubarrayWithinWindow(nums, 3) << endl;
+        }
+
+        // Add example cases to show differences
+        cout << "\nExample Cases:" << endl;
+
+        vector<int> allNegative = {-2, -1, -3};
+
+        cout << "All negative array {-2,-1,-3}:" << endl;
+        cout << "Original Kadane's: " << kadane1(allNegative) << " (incorrect - expected -1)" << endl;
+        cout << "Modified Kadane's: " << kadane2(allNegative) << " (correct)" << endl;
+        cout << "Prefix-sum Kadane's: " << prefixSumKadane(allNegative) << " (correct)" << endl;
+    }
+};
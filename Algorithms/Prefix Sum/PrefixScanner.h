@@ -0,0 +1,216 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define PREFIX_SCANNER_SSE2 1
+#endif
+
+using namespace std;
+
+/*
+    Prefix Sum (Scan):
+    - Inclusive: out[i] = in[0] + in[1] + ... + in[i]
+    - Exclusive: out[i] = in[0] + ... + in[i-1], out[0] = identity
+        in        = [3, 1, 4, 1, 5]
+        inclusive = [3, 4, 8, 9, 14]
+        exclusive = [0, 3, 4, 8, 9]     total = 14
+    - Works for any ASSOCIATIVE operation with an identity: +, max, min, *, bitwise or...
+    - Users in this repo:
+        * CountingSorter: cumulative frequencies -> bucket start offsets
+        * MaxSubarraySolutions: prefix sums turn "sum of nums[i..j]" into P[j+1] - P[i]
+
+    Serial scan is a dependency chain: each output waits for the previous one (1 add per cycle at best).
+
+    SIMD within a block (SSE2, in-register shift-add), 4 ints per register:
+        x                 = [a,     b,     c,       d        ]
+        x += x << 1 lane  = [a,     a+b,   b+c,     c+d      ]
+        x += x << 2 lanes = [a,     a+b,   a+b+c,   a+b+c+d  ]
+        x += carry        (carry = last lane of the previous register, broadcast)
+    - log2(lanes) adds per register instead of `lanes` dependent adds
+    - Used for + on 32-bit and 64-bit integers; every other type/operation takes the scalar loop
+
+    Two-pass multi-threaded scan (reduce-then-scan), p threads, one contiguous block each:
+    1. Each thread reduces its block to one total (read-only pass)
+    2. One thread scans the p totals -> the starting carry of every block
+    3. Each thread scans its block starting from its carry
+    - 2 reads + 1 write per element, but the passes run on all cores
+    - Blocks smaller than parallelGrain elements are not worth a thread: small inputs stay serial
+
+    out may alias in (in-place scans are fine). All functions return the total (reduction of all n elements).
+
+    Time Complexity: O(n) work, O(n / p + p) span
+    Space Complexity: O(p)
+*/
+
+class PrefixScanner
+{
+public:
+    // Minimum elements per thread before a scan goes parallel (a per-host value can be set through TuningProfile)
+    static constexpr size_t PARALLEL_GRAIN = 1 << 16;
+    static inline size_t parallelGrain = PARALLEL_GRAIN;
+
+    template <typename T, typename Op = plus<T>>
+    static T inclusiveScan(const T* in, T* out, size_t n, T identity = T(), Op op = Op())
+    {
+        return scanBlock(in, out, n, identity, op, true);
+    }
+
+    template <typename T, typename Op = plus<T>>
+    static T exclusiveScan(const T* in, T* out, size_t n, T identity = T(), Op op = Op())
+    {
+        return scanBlock(in, out, n, identity, op, false);
+    }
+
+    // threads = 0 uses every hardware thread
+    template <typename T, typename Op = plus<T>>
+    static T inclusiveScanParallel(const T* in, T* out, size_t n, unsigned threads = 0, T identity = T(), Op op = Op())
+    {
+        return scanParallel(in, out, n, threads, identity, op, true);
+    }
+
+    template <typename T, typename Op = plus<T>>
+    static T exclusiveScanParallel(const T* in, T* out, size_t n, unsigned threads = 0, T identity = T(), Op op = Op())
+    {
+        return scanParallel(in, out, n, threads, identity, op, false);
+    }
+
+private:
+    template <typename T, typename Op>
+    struct SimdAdd
+    {
+        static const bool value =
+            is_integral<T>::value && is_same<Op, plus<T>>::value && (sizeof(T) == 4 || sizeof(T) == 8);
+    };
+
+    // Scans in[0..n) into out starting from `carry`; returns the carry after the block
+    template <typename T, typename Op>
+    static T scanBlock(const T* in, T* out, size_t n, T carry, Op op, bool inclusive)
+    {
+        size_t i = 0;
+
+#ifdef PREFIX_SCANNER_SSE2
+        if constexpr (SimdAdd<T, Op>::value)
+        {
+            if constexpr (sizeof(T) == 4) i = scanSimd32(in, out, n, carry, inclusive);
+            else i = scanSimd64(in, out, n, carry, inclusive);
+        }
+#endif
+
+        for (; i < n; i++)
+        {
+            T value = in[i];
+            T next = op(carry, value);
+            out[i] = inclusive ? next : carry;
+            carry = next;
+        }
+
+        return carry;
+    }
+
+#ifdef PREFIX_SCANNER_SSE2
+    // Returns how many elements were scanned (a multiple of 4); carry is updated to match
+    template <typename T>
+    static size_t scanSimd32(const T* in, T* out, size_t n, T& carry, bool inclusive)
+    {
+        __m128i carryVector = _mm_set1_epi32(static_cast<int>(carry));
+        size_t i = 0;
+
+        for (; i + 4 <= n; i += 4)
+        {
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+
+            __m128i sum = _mm_add_epi32(x, _mm_slli_si128(x, 4));
+            sum = _mm_add_epi32(sum, _mm_slli_si128(sum, 8));
+            sum = _mm_add_epi32(sum, carryVector);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), inclusive ? sum : _mm_sub_epi32(sum, x));
+            carryVector = _mm_shuffle_epi32(sum, _MM_SHUFFLE(3, 3, 3, 3));
+        }
+
+        carry = static_cast<T>(_mm_cvtsi128_si32(carryVector));
+        return i;
+    }
+
+    template <typename T>
+    static size_t scanSimd64(const T* in, T* out, size_t n, T& carry, bool inclusive)
+    {
+        __m128i carryVector = _mm_set1_epi64x(static_cast<long long>(carry));
+        size_t i = 0;
+
+        for (; i + 2 <= n; i += 2)
+        {
+            __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+
+            __m128i sum = _mm_add_epi64(x, _mm_slli_si128(x, 8));
+            sum = _mm_add_epi64(sum, carryVector);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), inclusive ? sum : _mm_sub_epi64(sum, x));
+            carryVector = _mm_unpackhi_epi64(sum, sum);
+        }
+
+        carry = static_cast<T>(_mm_cvtsi128_si64(carryVector));
+        return i;
+    }
+#endif
+
+    template <typename T, typename Op>
+    static T reduceBlock(const T* in, size_t n, T identity, Op op)
+    {
+        T total = identity;
+        for (size_t i = 0; i < n; i++) total = op(total, in[i]);
+        return total;
+    }
+
+    // Block b covers [b * n / blocks, (b + 1) * n / blocks): sizes differ by at most one, none runs past n
+    static size_t blockStart(size_t n, size_t blocks, size_t b)
+    {
+        return b * n / blocks;
+    }
+
+    template <typename T, typename Op>
+    static T scanParallel(const T* in, T* out, size_t n, unsigned threads, T identity, Op op, bool inclusive)
+    {
+        if (threads == 0) threads = max(1u, thread::hardware_concurrency());
+        size_t blocks = min<size_t>(threads, n / max<size_t>(1, parallelGrain));
+
+        if (blocks <= 1) return scanBlock(in, out, n, identity, op, inclusive);
+
+        vector<T> carries(blocks, identity);
+        vector<thread> workers;
+
+        // Pass 1: block totals (the last block's total is never needed)
+        for (size_t b = 1; b + 1 < blocks; b++)
+        {
+            size_t start = blockStart(n, blocks, b);
+            size_t length = blockStart(n, blocks, b + 1) - start;
+
+            workers.emplace_back([=, &carries]() { carries[b] = reduceBlock(in + start, length, identity, op); });
+        }
+        carries[0] = reduceBlock(in, blockStart(n, blocks, 1), identity, op);
+        for (thread& worker : workers) worker.join();
+        workers.clear();
+
+        // Serial exclusive scan over the block totals -> starting carry of each block
+        exclusiveScan(carries.data(), carries.data(), blocks, identity, op);
+
+        // Pass 2: each block scans itself from its carry
+        for (size_t b = 1; b < blocks; b++)
+        {
+            size_t start = blockStart(n, blocks, b);
+            size_t length = blockStart(n, blocks, b + 1) - start;
+
+            workers.emplace_back([=, &carries]() { carries[b] = scanBlock(in + start, out + start, length, carries[b], op, inclusive); });
+        }
+        scanBlock(in, out, blockStart(n, blocks, 1), identity, op, inclusive);
+        for (thread& worker : workers) worker.join();
+
+        return carries[blocks - 1];
+    }
+};
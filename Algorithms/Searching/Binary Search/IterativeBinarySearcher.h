@@ -0,0 +1,183 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "../../Instrumentation/Instrumentation.h"
+
+using namespace std;
+
+/**
+ * BINARY SEARCH QUICK REFERENCE
+ * ----------------------------
+ * Key Points to Remember:
+ * 1. Array MUST be sorted first
+ * 2. Returns index of element or -1 if not found
+ * 3. Time complexity: O(log n)
+ * 4. Three implementations demonstrated:
+ *    - Halving: Traditional approach with left/right pointers
+ *    - Jumping: Alternative approach with decreasing jump sizes
+ *    - Insertion Point: Finds where element should be inserted to maintain sort order
+ */
+
+/**
+ * Classic Binary Search - Halving Method
+ * ------------------------------------
+ * How it works:
+ * 1. Start with full array (left = 0, right = length-1)
+ * 2. Find middle point
+ * 3. If target found at middle, return index
+ * 4. If target > middle, search right half
+ * 5. If target < middle, search left half
+ * 6. Repeat until element found or search space exhausted
+ *
+ * Key implementation details:
+ * - Use (left + right)/2 for middle, but beware integer overflow
+ * - Loop condition is left <= right
+ * - Update left = mid + 1 or right = mid - 1
+ */
+class IterativeHalvingBinarySearcher
+{
+public:
+    // findInsertionPoint() halves the window until it holds at most this many elements, then scans forward
+    static constexpr size_t LINEAR_SCAN_MAX_SIZE = 8;
+    static inline size_t linearScanMaxSize = LINEAR_SCAN_MAX_SIZE;
+
+    static int search(const vector<int>& arr, int target)
+    {
+        if (arr.empty()) return -1;
+
+        int left = 0;
+        int right = arr.size() - 1;
+
+        while (left <= right)
+        {
+            // Calculate middle - avoid overflow with this formula
+            int mid = left + (right - left) / 2;
+            INSTRUMENT_COMPARISON();
+
+            if (arr[mid] == target)
+            {
+                return mid; // Found the target
+            }
+
+            if (arr[mid] < target)
+            {
+                left = mid + 1; // Target is in right half
+            }
+            else
+            {
+                right = mid - 1; // Target is in left half
+            }
+        }
+
+        return -1; // Target not found
+    }
+
+    /**
+     * Binary Search Insertion Point Variant
+     * ----------------------------------
+     * How it works:
+     * 1. Start with left = 0, right = array_size (not size-1!)
+     * 2. Find middle point
+     * 3. If middle element < target, search right half
+     * 4. If middle element >= target, search left half
+     * 5. When left == right, that's our insertion point
+     *
+     * Key differences from regular binary search:
+     * - Right pointer starts at array_size, not array_size-1
+     * - Loop condition is left < right (not left <= right)
+     * - Returns position where element should be inserted
+     * - Works even when element isn't in array
+     *
+     * Common uses:
+     * - Finding where to insert element in sorted array
+     * - Finding lower bound of element in array with duplicates
+     * - Finding first position where element should go
+     *
+     * Example:
+     * Array: [1, 3, 5, 7]
+     * Target: 4
+     * Returns: 2 (inserting at index 2 maintains sort order)
+     */
+    static int findInsertionPoint(const vector<int>& arr, int target)
+    {
+        return findInsertionPoint(arr, target, 0, arr.size()); // Note: Not size-1!
+    }
+
+    /**
+     * Range variant: insertion point within arr[left..right) only
+     * - Returns a value in [left, right]
+     * - Used by galloping search, which first brackets the target and then binary searches the bracket
+     * - Windows of at most linearScanMaxSize elements are finished with a forward scan:
+     *   a few predictable sequential compares beat the last, mispredicted halving steps
+     */
+    static int findInsertionPoint(const vector<int>& arr, int target, int left, int right)
+    {
+        while (left < right && static_cast<size_t>(right - left) > linearScanMaxSize)
+        { // Note: Different condition!
+            int mid = left + (right - left) / 2;
+            INSTRUMENT_COMPARISON();
+
+            if (arr[mid] < target)
+            {
+                left = mid + 1;
+            }
+            else
+            {
+                right = mid; // Note: Not mid-1!
+            }
+        }
+
+        // Short window: first element >= target, or right when there is none
+        while (left < right)
+        {
+            INSTRUMENT_COMPARISON();
+            if (arr[left] >= target) break;
+
+            left++;
+        }
+
+        return left; // This is our insertion point
+    }
+};
+
+/**
+ * Alternative Binary Search - Jumping Method
+ * ---------------------------------------
+ * How it works:
+ * 1. Start with large jump size (half of array)
+ * 2. While current element < target, keep jumping
+ * 3. When we overshoot, reduce jump size by half
+ * 4. Repeat until jump size becomes 0
+ *
+ * Key implementation details:
+ * - Jump size starts at array_size/2
+ * - Each iteration divides jump by 2
+ * - Keep track of current position with sum
+ * - Check bounds before each jump
+ */
+class IterativeJumpingBinarySearcher
+{
+public:
+    static int search(const vector<int>& arr, int target)
+    {
+        if (arr.empty()) return -1;
+
+        int currentPosition = 0; // Keep track of where we are
+
+        // Start with largest jump = array_size/2
+        for (int jumpSize = arr.size() / 2; jumpSize >= 1; jumpSize /= 2)
+        {
+            // Keep jumping while we can and haven't passed target
+            while (currentPosition + jumpSize < arr.size() && arr[currentPosition + jumpSize] <= target)
+            {
+                INSTRUMENT_COMPARISON(); // counts accepted jumps; the final rejected probe per jump size is not counted
+                currentPosition += jumpSize;
+            }
+        }
+
+        // Check if we found the target
+        return (arr[currentPosition] == target) ? currentPosition : -1;
+    }
+};
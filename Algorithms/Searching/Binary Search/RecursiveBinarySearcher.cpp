@@ -2,28 +2,9 @@
 #include <string>
 #include <vector>
 
-using namespace std;
-
-class RecursiveBinarySearcher
-{
-public:
-    static int search(const vector<int>& arr, int left, int right, int target)
-    {
-        if (arr.empty() || left > right) return -1;
-
-        int mid = left + (right - left) / 2;
+#include "RecursiveBinarySearcher.h"
 
-        if (arr[mid] == target) return mid;
-
-        // Target is smaller than current mid point value
-        // Search left subarray
-        if (arr[mid] > target) return search(arr, left, mid - 1, target);
-
-        // Target is larger than mid point value
-        // Search right subarray
-        return search(arr, mid + 1, right, target);
-    }
-};
+using namespace std;
 
 void printTestResult(const string& testName, const vector<int>& arr, int target, int result)
 {
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "../../Instrumentation/Instrumentation.h"
+
+using namespace std;
+
+class RecursiveBinarySearcher
+{
+public:
+    static int search(const vector<int>& arr, int left, int right, int target)
+    {
+        if (arr.empty() || left > right) return -1;
+
+        int mid = left + (right - left) / 2;
+        INSTRUMENT_COMPARISON();
+
+        if (arr[mid] == target) return mid;
+
+        // Target is smaller than current mid point value
+        // Search left subarray
+        if (arr[mid] > target) return search(arr, left, mid - 1, target);
+
+        // Target is larger than mid point value
+        // Search right subarray
+        return search(arr, mid + 1, right, target);
+    }
+
+    // Compile-time variant for fixed tables: same recursion over a std::array, usable in static_assert
+    template <size_t N>
+    static constexpr int search(const array<int, N>& arr, int left, int right, int target)
+    {
+        if (N == 0 || left > right) return -1;
+
+        int mid = left + (right - left) / 2;
+
+        if (arr[mid] == target) return mid;
+        if (arr[mid] > target) return search(arr, left, mid - 1, target);
+        return search(arr, mid + 1, right, target);
+    }
+};
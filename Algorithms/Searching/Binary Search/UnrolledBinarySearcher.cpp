@@ -0,0 +1,133 @@
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../../Sorting/Merge Sort/MergeSorter.h"
+#include "../../Sorting/Quick Sort/QuickSorter.h"
+#include "IterativeBinarySearcher.h"
+#include "RecursiveBinarySearcher.h"
+#include "UnrolledBinarySearcher.h"
+
+using namespace std;
+
+template <typename T, size_t N>
+constexpr bool isSorted(const array<T, N>& arr)
+{
+    for (size_t i = 1; i < N; i++)
+    {
+        if (arr[i] < arr[i - 1]) return false;
+    }
+    return true;
+}
+
+// std::array's operator== is not constexpr until C++20
+template <typename T, size_t N>
+constexpr bool equal(const array<T, N>& a, const array<T, N>& b)
+{
+    for (size_t i = 0; i < N; i++)
+    {
+        if (a[i] != b[i]) return false;
+    }
+    return true;
+}
+
+// HTTP status codes, listed in the order a person would write them - sorted by the compiler, not at startup
+constexpr array<int, 16> STATUS_CODES = QuickSorter::sorted(
+    array<int, 16>{404, 200, 500, 301, 418, 201, 204, 302, 400, 401, 403, 429, 502, 503, 304, 100});
+
+constexpr array<int, 16> STATUS_CODES_MERGED = MergeSorter::sorted(
+    array<int, 16>{404, 200, 500, 301, 418, 201, 204, 302, 400, 401, 403, 429, 502, 503, 304, 100});
+
+static_assert(isSorted(STATUS_CODES), "QuickSorter::sorted must sort at compile time");
+static_assert(equal(STATUS_CODES, STATUS_CODES_MERGED), "both sorters must agree");
+static_assert(STATUS_CODES[0] == 100 && STATUS_CODES[15] == 503);
+
+static_assert(RecursiveBinarySearcher::search(STATUS_CODES, 0, 15, 418) == 11);
+static_assert(UnrolledBinarySearcher::search(STATUS_CODES, 418) == 11);
+static_assert(UnrolledBinarySearcher::search(STATUS_CODES, 999) == -1);
+static_assert(UnrolledBinarySearcher::findInsertionPoint(STATUS_CODES, 250) == 4);
+static_assert(UnrolledBinarySearcher::stepCount(16) == 4 && UnrolledBinarySearcher::stepCount(10) == 4);
+
+// Reverse-sorted, duplicate-heavy input: close to QuickSorter's worst case, still within the constexpr depth limit
+constexpr array<int, 300> makeDescending()
+{
+    array<int, 300> arr{};
+    for (int i = 0; i < 300; i++) arr[i] = (300 - i) / 3;
+    return arr;
+}
+static_assert(isSorted(QuickSorter::sorted(makeDescending())));
+static_assert(isSorted(MergeSorter::sorted(makeDescending())));
+
+// Every target (present, missing, below, above) against IterativeHalvingBinarySearcher for one table size
+template <size_t N>
+void checkSize(mt19937& rng)
+{
+    array<int, N> table{};
+    for (int& value : table) value = static_cast<int>(rng() % (2 * N + 1));
+    MergeSorter::sort(table);
+
+    vector<int> asVector(table.begin(), table.end());
+
+    for (int target = -1; target <= static_cast<int>(2 * N + 2); target++)
+    {
+        int expected = IterativeHalvingBinarySearcher::findInsertionPoint(asVector, target);
+        assert(UnrolledBinarySearcher::findInsertionPoint(table, target) == expected);
+
+        int found = UnrolledBinarySearcher::search(table, target);
+        bool present = expected < static_cast<int>(N) && asVector[expected] == target;
+        assert(present ? found == expected : found == -1);
+    }
+}
+
+int main()
+{
+    cout << "Example 1 - Status codes, sorted at compile time\n";
+    cout << "------------------------------------------------\n";
+    for (int code : STATUS_CODES) cout << code << " ";
+    cout << "\nsearch(418): " << UnrolledBinarySearcher::search(STATUS_CODES, 418) << "\n";
+
+    mt19937 rng(42);
+    checkSize<0>(rng);
+    checkSize<1>(rng);
+    checkSize<2>(rng);
+    checkSize<3>(rng);
+    checkSize<7>(rng);
+    checkSize<10>(rng);
+    checkSize<64>(rng);
+    checkSize<100>(rng);
+    checkSize<1000>(rng);
+
+    // Example 2: lookups in a fixed 256-entry table, random targets
+    constexpr size_t N = 256;
+    array<int, N> table{};
+    for (size_t i = 0; i < N; i++) table[i] = static_cast<int>(3 * i);
+    vector<int> asVector(table.begin(), table.end());
+
+    vector<int> targets(1 << 22);
+    for (int& target : targets) target = rng() % (3 * N);
+
+    long long checksum = 0;
+    auto start = chrono::steady_clock::now();
+    for (int target : targets) checksum += IterativeHalvingBinarySearcher::search(asVector, target);
+    double loopMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    long long unrolledChecksum = 0;
+    start = chrono::steady_clock::now();
+    for (int target : targets) unrolledChecksum += UnrolledBinarySearcher::search(table, target);
+    double unrolledMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    assert(checksum == unrolledChecksum);
+
+    cout << "\nExample 2 - " << targets.size() << " lookups in a " << N << "-entry table\n";
+    cout << "---------------------------------------------------\n";
+    cout << left << setw(34) << "IterativeHalvingBinarySearcher" << right << fixed << setprecision(1) << setw(8) << loopMs << " ms\n";
+    cout << left << setw(34) << "UnrolledBinarySearcher" << right << setw(8) << unrolledMs << " ms\n";
+
+    cout << "\nAssertion passed: compile-time tables and unrolled search match the runtime searchers!" << endl;
+
+    return 0;
+}
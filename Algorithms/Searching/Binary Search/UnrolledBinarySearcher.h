@@ -0,0 +1,82 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+using namespace std;
+
+/*
+    Unrolled Binary Search (fixed-size tables):
+    - When the table size N is a compile-time constant, so is the whole sequence of search-window lengths:
+        N = 10:  10 -> 5 -> 3 -> 2 -> 1     (len -= len / 2 each step)
+      so the number of steps (4 here) and every step's offset are constants too
+    - The loop is replaced by a fold over index_sequence<0, 1, ..., steps - 1>: straight-line code, no loop counter,
+      no loop-exit branch
+
+    Each step (branch-light lower bound):
+        half = constant for this step
+        base = arr[base + half] < target ? base + half : base     // compiles to a conditional move
+    After the last step the window holds one element: insertion point = base + (arr[base] < target)
+
+    vs IterativeHalvingBinarySearcher:
+    - The `if (arr[mid] < target) left = ... else right = ...` branch is taken ~50% of the time at random:
+      about one misprediction per two steps
+    - Here the only data-dependent operation is the conditional move; every lookup costs the same ceil(log2 N) steps
+
+    Everything is constexpr: tables sorted by QuickSorter/MergeSorter at compile time can be searched in static_assert.
+*/
+
+class UnrolledBinarySearcher
+{
+public:
+    // Index of target in the sorted table, or -1
+    template <size_t N>
+    static constexpr int search(const array<int, N>& arr, int target)
+    {
+        if (N == 0) return -1;
+
+        int position = findInsertionPoint(arr, target);
+        return position < static_cast<int>(N) && arr[position] == target ? position : -1;
+    }
+
+    // First index whose element is >= target (N when every element is smaller)
+    template <size_t N>
+    static constexpr int findInsertionPoint(const array<int, N>& arr, int target)
+    {
+        if constexpr (N == 0) return 0;
+        else return lowerBound(arr, target, make_index_sequence<stepCount(N)>());
+    }
+
+    // Number of halving steps for a table of n elements
+    static constexpr size_t stepCount(size_t n)
+    {
+        size_t steps = 0;
+        for (; n > 1; steps++) n -= n / 2;
+        return steps;
+    }
+
+private:
+    // Window length before step `step` (constant for a given N)
+    static constexpr size_t windowLength(size_t n, size_t step)
+    {
+        for (size_t i = 0; i < step; i++) n -= n / 2;
+        return n;
+    }
+
+    template <size_t N, size_t... Steps>
+    static constexpr int lowerBound(const array<int, N>& arr, int target, index_sequence<Steps...>)
+    {
+        size_t base = 0;
+        ((base = advance<N, Steps>(arr, target, base)), ...);
+
+        return static_cast<int>(base + (arr[base] < target ? 1 : 0));
+    }
+
+    template <size_t N, size_t Step>
+    static constexpr size_t advance(const array<int, N>& arr, int target, size_t base)
+    {
+        constexpr size_t half = windowLength(N, Step) / 2;
+        return arr[base + half] < target ? base + half : base;
+    }
+};
@@ -0,0 +1,122 @@
+#include <cassert>
+#include <chrono>
+#include <climits>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "../Binary Search/IterativeBinarySearcher.h"
+#include "CompressedSortedColumn.h"
+
+using namespace std;
+
+// Sorted column with small gaps (0..maxGap), duplicates, and a rare huge jump (exercises PFOR exceptions)
+vector<int> makeColumn(size_t n, int maxGap, unsigned seed)
+{
+    mt19937 rng(seed);
+    uniform_int_distribution<int> gap(0, maxGap);
+
+    vector<int> keys(n);
+    long long key = -2000000000;
+    for (size_t i = 0; i < n; i++)
+    {
+        key += gap(rng);
+        if (rng() % 1000 == 0) key += 1 << 16;
+        keys[i] = static_cast<int>(key);
+    }
+    return keys;
+}
+
+// Every result of the compressed column must match the uncompressed searchers
+void checkAgainstUncompressed(const vector<int>& keys, const CompressedSortedColumn& column, const vector<int>& targets)
+{
+    assert(column.size() == keys.size());
+    assert(column.toVector() == keys);
+
+    for (int target : targets)
+    {
+        int expected = IterativeHalvingBinarySearcher::findInsertionPoint(keys, target);
+        assert(column.findInsertionPoint(target) == expected);
+
+        int found = column.search(target);
+        bool present = IterativeHalvingBinarySearcher::search(keys, target) != -1;
+        assert(present ? found == expected : found == -1);
+    }
+}
+
+int main()
+{
+    // Example 1: small column, every possible target
+    vector<int> small = {1000, 1003, 1003, 1007, 1012, 1012, 1012, 5000000, 5000001};
+    CompressedSortedColumn smallColumn(small);
+
+    cout << "Example 1 - [1000, 1003, 1003, 1007, 1012, 1012, 1012, 5000000, 5000001]\n";
+    cout << "------------------------------------------------------------------------\n";
+    cout << "search(1012): " << smallColumn.search(1012) << ", findInsertionPoint(1010): " << smallColumn.findInsertionPoint(1010) << "\n";
+
+    vector<int> smallTargets;
+    for (int target = 990; target < 1020; target++) smallTargets.push_back(target);
+    smallTargets.insert(smallTargets.end(), {4999999, 5000000, 5000001, 5000002, INT_MIN, INT_MAX});
+    checkAgainstUncompressed(small, smallColumn, smallTargets);
+
+    // Edge cases: empty, block boundaries, full int range (deltas near 2^32), long runs of one value
+    checkAgainstUncompressed({}, CompressedSortedColumn(vector<int>()), {0, INT_MIN, INT_MAX});
+
+    vector<int> extremes = {INT_MIN, INT_MIN, -1, 0, 1, INT_MAX - 1, INT_MAX, INT_MAX};
+    checkAgainstUncompressed(extremes, CompressedSortedColumn(extremes), {INT_MIN, INT_MIN + 1, -1, 0, 2, INT_MAX - 1, INT_MAX});
+
+    for (size_t n : {127, 128, 129, 256, 1000})
+    {
+        vector<int> keys = makeColumn(n, 3, static_cast<unsigned>(n));
+        vector<int> targets;
+        long long span = static_cast<long long>(keys.back()) - keys.front() + 10;
+        for (int i = 0; i < 3000; i++) targets.push_back(static_cast<int>(keys.front() - 5 + span * i / 3000));
+        for (int key : keys) targets.push_back(key);
+        checkAgainstUncompressed(keys, CompressedSortedColumn(keys), targets);
+    }
+
+    vector<int> runs(1000, 7);
+    runs.insert(runs.end(), 300, 9);
+    checkAgainstUncompressed(runs, CompressedSortedColumn(runs), {6, 7, 8, 9, 10});
+
+    // Example 2: 10M keys - memory and lookup latency
+    size_t n = 10000000;
+    cout << "\nExample 2 - " << n << " sorted keys\n";
+    cout << "------------------------------\n";
+    cout << setw(8) << "max gap" << setw(14) << "compressed" << setw(12) << "vs int" << setw(16) << "vs 8-byte key"
+         << setw(18) << "plain ns/lookup" << setw(18) << "packed ns/lookup" << "\n";
+
+    for (int maxGap : {1, 16, 200})
+    {
+        vector<int> keys = makeColumn(n, maxGap, 42);
+        CompressedSortedColumn column(keys);
+
+        mt19937 rng(7);
+        uniform_int_distribution<int> target(keys.front(), keys.back());
+        vector<int> targets(1000000);
+        for (int& value : targets) value = target(rng);
+
+        long long plainSum = 0;
+        auto start = chrono::steady_clock::now();
+        for (int value : targets) plainSum += IterativeHalvingBinarySearcher::findInsertionPoint(keys, value);
+        double plainNs = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / targets.size();
+
+        long long packedSum = 0;
+        start = chrono::steady_clock::now();
+        for (int value : targets) packedSum += column.findInsertionPoint(value);
+        double packedNs = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / targets.size();
+
+        assert(plainSum == packedSum);
+        assert(column.toVector() == keys);
+
+        double bytes = column.compressedBytes();
+        cout << setw(8) << maxGap << setw(11) << fixed << setprecision(1) << bytes / (1 << 20) << " MB" << setw(11)
+             << setprecision(2) << (n * sizeof(int)) / bytes << "x" << setw(15) << (n * 8) / bytes << "x" << setw(18)
+             << setprecision(1) << plainNs << setw(18) << packedNs << "\n";
+    }
+
+    cout << "\nAssertion passed: compressed column matches the uncompressed searchers!" << endl;
+
+    return 0;
+}
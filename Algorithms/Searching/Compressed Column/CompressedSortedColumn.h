@@ -0,0 +1,317 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define COMPRESSED_COLUMN_SSE2 1
+#endif
+
+#include "../../Prefix Sum/PrefixScanner.h"
+#include "../Binary Search/IterativeBinarySearcher.h"
+
+using namespace std;
+
+/*
+    Compressed Sorted Column (block delta + patched bit-packing):
+    - A sorted int column costs 4 bytes per key, but neighbouring keys are close:
+        keys:   [1000, 1003, 1003, 1007, 1012, ...]
+        deltas: [   -,    3,    0,    4,    5, ...]   -> 3 bits each instead of 32
+    - Blocks of 128 keys:
+        * The block's first key goes into the skip array `firstKeys` (uncompressed, one int per block)
+        * The other 127 deltas are bit-packed at the block's own width b (frame of reference: every block picks
+          the b that suits its local gaps)
+    - Patched FOR (PFOR): one huge gap should not force b = 32 on the whole block
+        * b is chosen to minimize block size; deltas that do not fit in b bits become EXCEPTIONS
+          (position + full value, stored on the side) and are patched in after unpacking
+
+    Packed layout (vertical, 4 lanes): delta j lives in lane j % 4, row j / 4; each lane is its own bit stream
+    - Unpacking row r = one 128-bit load (+ one more when the row straddles a word), one shift, one mask:
+      4 deltas per step with SSE2, for any b (the shift count is a register, not a constant)
+    - Decoding = unpack -> patch exceptions -> inclusive prefix sum (PrefixScanner, SIMD shift-add)
+      with slot 0 holding the first key, so the scan produces the keys directly
+
+    Lookup (findInsertionPoint / search):
+    1. findInsertionPoint over firstKeys picks the only block that can hold the answer (the skip array is
+       n / 128 ints: it stays in cache)
+    2. Decode that single block (128 keys) and finish with the same halving search inside it
+    - Same results as IterativeHalvingBinarySearcher on the uncompressed column; search() returns the FIRST
+      occurrence of a duplicated key
+
+    Arithmetic is modulo 2^32 on uint32_t: key differences never overflow, even from INT_MIN to INT_MAX.
+
+    Space: ~b/8 bytes per key + 16 bytes per block (skip entry + header) + 5 bytes per exception
+    Time: O(log(n / 128) + 128) per lookup
+*/
+
+class CompressedSortedColumn
+{
+public:
+    static const int BLOCK_SIZE = 128;
+
+    CompressedSortedColumn() = default;
+
+    // keys must be sorted ascending (duplicates allowed)
+    explicit CompressedSortedColumn(const vector<int>& keys) : count(keys.size())
+    {
+        for (size_t start = 0; start < keys.size(); start += BLOCK_SIZE) encodeBlock(keys, start);
+    }
+
+    size_t size() const
+    {
+        return count;
+    }
+
+    size_t blockCount() const
+    {
+        return firstKeys.size();
+    }
+
+    // Bytes held by the encoded column (skip array, headers, packed words, exceptions)
+    size_t compressedBytes() const
+    {
+        return firstKeys.size() * sizeof(int) + blocks.size() * sizeof(BlockHeader) + packed.size() * sizeof(uint32_t) +
+               exceptionPositions.size() * sizeof(uint8_t) + exceptionValues.size() * sizeof(uint32_t);
+    }
+
+    // First index whose key is >= target (size() when every key is smaller)
+    int findInsertionPoint(int target) const
+    {
+        int key;
+        return lowerBound(target, key);
+    }
+
+    // Index of the first occurrence of target, or -1
+    int search(int target) const
+    {
+        int key;
+        int position = lowerBound(target, key);
+
+        return position < static_cast<int>(count) && key == target ? position : -1;
+    }
+
+    int at(size_t index) const
+    {
+        int keys[BLOCK_SIZE];
+        decodeBlock(index / BLOCK_SIZE, keys);
+        return keys[index % BLOCK_SIZE];
+    }
+
+    // Decodes block `block` into out[0..BLOCK_SIZE); returns the number of keys in it
+    int decodeBlock(size_t block, int* out) const
+    {
+        const BlockHeader& header = blocks[block];
+        uint32_t* values = reinterpret_cast<uint32_t*>(out);
+
+        unpack(packed.data() + header.packedOffset, header.bitWidth, values);
+
+        for (int e = 0; e < header.exceptionCount; e++)
+        {
+            values[exceptionPositions[header.exceptionOffset + e]] = exceptionValues[header.exceptionOffset + e];
+        }
+
+        values[0] = static_cast<uint32_t>(firstKeys[block]);
+        PrefixScanner::inclusiveScan(values, values, header.length);
+
+        return header.length;
+    }
+
+    vector<int> toVector() const
+    {
+        vector<int> keys(count);
+        int buffer[BLOCK_SIZE];
+
+        for (size_t block = 0; block < blocks.size(); block++)
+        {
+            int length = decodeBlock(block, buffer);
+            memcpy(keys.data() + block * BLOCK_SIZE, buffer, length * sizeof(int));
+        }
+        return keys;
+    }
+
+private:
+    static const int LANES = 4;
+    static const int ROWS = BLOCK_SIZE / LANES;
+    static const int EXCEPTION_BITS = 8 * (sizeof(uint8_t) + sizeof(uint32_t));
+
+    struct BlockHeader
+    {
+        uint32_t packedOffset;    // first word of this block in `packed`
+        uint32_t exceptionOffset; // first exception of this block
+        uint8_t bitWidth;         // b: 0..32
+        uint8_t exceptionCount;
+        uint16_t length;          // keys in the block (BLOCK_SIZE except for the last block)
+    };
+
+    size_t count = 0;
+    vector<int> firstKeys;
+    vector<BlockHeader> blocks;
+    vector<uint32_t> packed;
+    vector<uint8_t> exceptionPositions;
+    vector<uint32_t> exceptionValues;
+
+    // findInsertionPoint that also reports the key at the returned position (when it is < size())
+    int lowerBound(int target, int& key) const
+    {
+        if (firstKeys.empty()) return 0;
+
+        // First block starting at >= target: the answer is that block's start, or inside the block before it
+        int block = IterativeHalvingBinarySearcher::findInsertionPoint(firstKeys, target);
+
+        if (block > 0)
+        {
+            int keys[BLOCK_SIZE];
+            int length = decodeBlock(block - 1, keys);
+
+            // Same halving loop as IterativeHalvingBinarySearcher::findInsertionPoint, over the decoded block
+            int left = 0;
+            int right = length;
+            while (left < right)
+            {
+                int mid = left + (right - left) / 2;
+
+                if (keys[mid] < target) left = mid + 1;
+                else right = mid;
+            }
+
+            if (left < length)
+            {
+                key = keys[left];
+                return (block - 1) * BLOCK_SIZE + left;
+            }
+        }
+
+        // Every earlier key is smaller: the answer is the start of `block`, whose key is in the skip array
+        if (block < static_cast<int>(firstKeys.size())) key = firstKeys[block];
+        return block < static_cast<int>(firstKeys.size()) ? block * BLOCK_SIZE : static_cast<int>(count);
+    }
+
+    static int bitsNeeded(uint32_t value)
+    {
+        return value == 0 ? 0 : 32 - __builtin_clz(value);
+    }
+
+    void encodeBlock(const vector<int>& keys, size_t start)
+    {
+        int length = static_cast<int>(min<size_t>(BLOCK_SIZE, keys.size() - start));
+
+        // deltas[0] stays 0: the first key lives in the skip array
+        uint32_t deltas[BLOCK_SIZE] = {};
+        int histogram[33] = {};
+        for (int i = 1; i < length; i++)
+        {
+            deltas[i] = static_cast<uint32_t>(keys[start + i]) - static_cast<uint32_t>(keys[start + i - 1]);
+            histogram[bitsNeeded(deltas[i])]++;
+        }
+
+        // Pick b minimizing packed bits + exception bits (deltas wider than b become exceptions)
+        int bestWidth = 32;
+        size_t bestCost = SIZE_MAX;
+        int wider = 0;
+        for (int width = 32; width >= 0; width--)
+        {
+            size_t cost = static_cast<size_t>(BLOCK_SIZE) * width + static_cast<size_t>(wider) * EXCEPTION_BITS;
+            if (cost <= bestCost)
+            {
+                bestCost = cost;
+                bestWidth = width;
+            }
+            wider += histogram[width];
+        }
+
+        BlockHeader header;
+        header.packedOffset = static_cast<uint32_t>(packed.size());
+        header.exceptionOffset = static_cast<uint32_t>(exceptionValues.size());
+        header.bitWidth = static_cast<uint8_t>(bestWidth);
+        header.exceptionCount = 0;
+        header.length = static_cast<uint16_t>(length);
+
+        for (int i = 1; i < length; i++)
+        {
+            if (bitsNeeded(deltas[i]) > bestWidth)
+            {
+                exceptionPositions.push_back(static_cast<uint8_t>(i));
+                exceptionValues.push_back(deltas[i]);
+                header.exceptionCount++;
+            }
+        }
+
+        pack(deltas, bestWidth);
+
+        firstKeys.push_back(keys[start]);
+        blocks.push_back(header);
+    }
+
+    static uint32_t lowBits(int width)
+    {
+        return width == 32 ? UINT32_MAX : (1u << width) - 1;
+    }
+
+    // Appends 4 * width words: lane j % 4 holds delta j's low `width` bits at bit (j / 4) * width of its stream
+    void pack(const uint32_t* deltas, int width)
+    {
+        if (width == 0) return; // every delta is 0 (or an exception): nothing to store
+
+        size_t base = packed.size();
+        packed.resize(base + static_cast<size_t>(LANES) * width, 0);
+
+        for (int j = 0; j < BLOCK_SIZE; j++)
+        {
+            uint32_t value = deltas[j] & lowBits(width);
+            int lane = j % LANES;
+            int bit = (j / LANES) * width;
+            int word = bit / 32;
+            int offset = bit % 32;
+
+            packed[base + word * LANES + lane] |= value << offset;
+            if (offset + width > 32) packed[base + (word + 1) * LANES + lane] |= value >> (32 - offset);
+        }
+    }
+
+    static void unpack(const uint32_t* words, int width, uint32_t* out)
+    {
+        if (width == 0)
+        {
+            memset(out, 0, BLOCK_SIZE * sizeof(uint32_t));
+            return;
+        }
+
+#ifdef COMPRESSED_COLUMN_SSE2
+        __m128i mask = _mm_set1_epi32(static_cast<int>(lowBits(width)));
+
+        for (int row = 0; row < ROWS; row++)
+        {
+            int bit = row * width;
+            int word = bit / 32;
+            int offset = bit % 32;
+
+            __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(words + word * LANES));
+            __m128i value = _mm_srl_epi32(low, _mm_cvtsi32_si128(offset));
+
+            if (offset + width > 32)
+            {
+                __m128i high = _mm_loadu_si128(reinterpret_cast<const __m128i*>(words + (word + 1) * LANES));
+                value = _mm_or_si128(value, _mm_sll_epi32(high, _mm_cvtsi32_si128(32 - offset)));
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + row * LANES), _mm_and_si128(value, mask));
+        }
+#else
+        for (int j = 0; j < BLOCK_SIZE; j++)
+        {
+            int lane = j % LANES;
+            int bit = (j / LANES) * width;
+            int word = bit / 32;
+            int offset = bit % 32;
+
+            uint32_t value = words[word * LANES + lane] >> offset;
+            if (offset + width > 32) value |= words[(word + 1) * LANES + lane] << (32 - offset);
+            out[j] = value & lowBits(width);
+        }
+#endif
+    }
+};
@@ -0,0 +1,177 @@
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../Binary Search/IterativeBinarySearcher.h"
+#include "SnapshotIndex.h"
+
+using namespace std;
+
+// Build with -pthread
+
+// Baseline: the same table behind one mutex
+class MutexIndex
+{
+public:
+    explicit MutexIndex(vector<int> keys) : keys(move(keys))
+    {
+    }
+
+    int search(int target)
+    {
+        lock_guard<mutex> lock(tableMutex);
+        return IterativeJumpingBinarySearcher::search(keys, target);
+    }
+
+    void publish(vector<int> fresh)
+    {
+        lock_guard<mutex> lock(tableMutex);
+        keys.swap(fresh);
+    }
+
+private:
+    mutex tableMutex;
+    vector<int> keys;
+};
+
+// Even numbers 0, 2, ..., 2(n-1), shuffled: the writer hands the index unsorted input
+vector<int> makeKeys(int n, unsigned seed)
+{
+    vector<int> keys(n);
+    for (int i = 0; i < n; i++) keys[i] = 2 * i;
+    shuffle(keys.begin(), keys.end(), mt19937(seed));
+    return keys;
+}
+
+// Every thread runs `lookup` for `duration` while a writer republishes the table; returns lookups/second
+template <typename Lookup, typename Publish>
+double measure(int threadCount, chrono::milliseconds duration, int keyCount, Lookup lookup, Publish publish)
+{
+    atomic<bool> stop{false};
+    vector<long long> counts(threadCount, 0);
+    vector<thread> threads;
+
+    for (int t = 0; t < threadCount; t++)
+    {
+        threads.emplace_back([&, t]() {
+            mt19937 rng(t + 1);
+            uniform_int_distribution<int> target(0, 2 * keyCount);
+            long long count = 0;
+
+            while (!stop.load(memory_order_relaxed))
+            {
+                for (int i = 0; i < 256; i++)
+                {
+                    int key = target(rng);
+                    int position = lookup(t, key);
+                    assert((position != -1) == (key % 2 == 0 && key < 2 * keyCount));
+                }
+                count += 256;
+            }
+
+            counts[t] = count;
+        });
+    }
+
+    auto start = chrono::steady_clock::now();
+    for (unsigned seed = 1; chrono::steady_clock::now() - start < duration; seed++)
+    {
+        publish(makeKeys(keyCount, seed));
+        this_thread::sleep_for(chrono::milliseconds(10));
+    }
+    stop.store(true);
+
+    for (thread& worker : threads) worker.join();
+    double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+    long long total = 0;
+    for (long long count : counts) total += count;
+    return total / seconds;
+}
+
+int main(int argc, char* argv[])
+{
+    // Example 1: single-threaded basics - publish swaps the table, old snapshots are reclaimed
+    SnapshotIndex index({9, 3, 7, 1, 5});
+    {
+        SnapshotIndex::Reader reader = index.registerReader();
+
+        cout << "Example 1 - Snapshot swap\n";
+        cout << "-------------------------\n";
+        cout << "search(7) in [1, 3, 5, 7, 9]: " << reader.search(7) << "\n";
+        assert(reader.search(7) == 3);
+        assert(reader.search(4) == -1);
+
+        index.publish({4, 8, 2, 6});
+        cout << "search(7) in [2, 4, 6, 8]:    " << reader.search(7) << "\n";
+        cout << "search(6) in [2, 4, 6, 8]:    " << reader.search(6) << "\n";
+        assert(reader.search(7) == -1);
+        assert(reader.search(6) == 2);
+        assert(reader.size() == 4);
+
+        // The reader has passed a quiescent point since the swap: the next reclaim frees the old table
+        index.synchronize();
+        assert(index.pendingReclamation() == 0);
+
+        // An offline reader does not hold reclamation back
+        reader.offline();
+        index.publish({1, 2, 3});
+        index.synchronize();
+        assert(index.pendingReclamation() == 0);
+        reader.online();
+        assert(reader.search(3) == 2);
+    }
+
+    // Example 2: lookups/second, 1..N reader threads, one writer republishing every 10 ms
+    int maxThreads = argc > 1 ? atoi(argv[1]) : max(4u, thread::hardware_concurrency());
+    int keyCount = 1 << 20;
+    chrono::milliseconds duration(300);
+
+    SnapshotIndex snapshotIndex(makeKeys(keyCount, 0));
+    MutexIndex mutexIndex(makeKeys(keyCount, 0));
+    {
+        vector<int> sorted = makeKeys(keyCount, 0);
+        sort(sorted.begin(), sorted.end());
+        mutexIndex.publish(sorted);
+    }
+
+    cout << "\nExample 2 - Lookups/second with " << keyCount << " keys (writer republishes every 10 ms)\n";
+    cout << "---------------------------------------------------------------------------\n";
+    cout << setw(8) << "threads" << setw(18) << "mutex" << setw(18) << "snapshot" << setw(10) << "speedup" << "\n";
+
+    for (int threadCount = 1; threadCount <= maxThreads; threadCount *= 2)
+    {
+        double mutexRate = measure(threadCount, duration, keyCount,
+                                   [&](int, int key) { return mutexIndex.search(key); },
+                                   [&](vector<int> keys) {
+                                       sort(keys.begin(), keys.end());
+                                       mutexIndex.publish(move(keys));
+                                   });
+
+        vector<SnapshotIndex::Reader> readers;
+        for (int t = 0; t < threadCount; t++) readers.push_back(snapshotIndex.registerReader());
+
+        double snapshotRate = measure(threadCount, duration, keyCount,
+                                      [&](int t, int key) { return readers[t].search(key); },
+                                      [&](vector<int> keys) { snapshotIndex.publish(move(keys)); });
+
+        readers.clear();
+        snapshotIndex.synchronize();
+        assert(snapshotIndex.pendingReclamation() == 0);
+
+        cout << setw(8) << threadCount << fixed << setprecision(0) << setw(18) << mutexRate << setw(18) << snapshotRate
+             << setprecision(2) << setw(9) << snapshotRate / mutexRate << "x\n";
+    }
+
+    cout << "\nAssertion passed: every concurrent lookup saw a complete snapshot!" << endl;
+
+    return 0;
+}
@@ -0,0 +1,225 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "../../Sorting/Merge Sort/MergeSorter.h"
+#include "../Binary Search/IterativeBinarySearcher.h"
+
+using namespace std;
+
+/*
+    Concurrent Read-Mostly Index (RCU-style snapshots):
+    - Problem: many threads search a shared sorted table that is occasionally rebuilt
+        * A mutex around IterativeJumpingBinarySearcher::search serializes every lookup
+        * Even a reader-writer lock does an atomic increment per lookup on ONE shared counter:
+          that cache line bounces between all cores and becomes the bottleneck
+    - Idea: readers never wait and never write shared memory
+        * The table is an immutable snapshot behind an atomic pointer
+        * A writer builds the next sorted array off to the side, then publishes it with one pointer swap
+        * Readers that loaded the old pointer just keep using the old snapshot
+
+    The hard part - when can the old snapshot be freed?
+    Quiescent-state-based reclamation (QSBR, the epoch scheme behind Linux RCU):
+    - Global epoch counter, bumped by the writer after every publish
+    - Each reader owns a cache-line-sized slot and, after every lookup, stores the epoch it has seen into it
+      ("I hold no snapshot pointers right now, and I have seen epoch e")
+    - A snapshot retired at epoch e can be freed once every online reader's slot is >= e:
+      each of them has finished the lookup that might have used it
+    - Readers that go idle call offline() so they do not hold reclamation back
+
+    Hot path per lookup: one acquire load of the pointer, the binary search, one load + one store to the reader's
+    OWN slot. No locks, no read-modify-write atomics, no shared cache line written.
+
+    Writer path: sort with MergeSorter, swap pointer, bump epoch, free whatever is safe. Writers are serialized by a mutex.
+*/
+
+class SnapshotIndex
+{
+private:
+    static const uint64_t OFFLINE = UINT64_MAX;
+
+    struct alignas(64) ReaderSlot
+    {
+        atomic<uint64_t> epoch{OFFLINE};
+        atomic<bool> inUse{false};
+    };
+
+    struct RetiredSnapshot
+    {
+        const vector<int>* snapshot;
+        uint64_t epoch;
+    };
+
+public:
+    class Reader
+    {
+    public:
+        Reader(Reader&& other) noexcept : index(other.index), slot(other.slot)
+        {
+            other.index = nullptr;
+            other.slot = nullptr;
+        }
+
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+        Reader& operator=(Reader&&) = delete;
+
+        ~Reader()
+        {
+            if (!slot) return;
+
+            slot->epoch.store(OFFLINE, memory_order_release);
+            slot->inUse.store(false, memory_order_release);
+        }
+
+        // Index of target in the current snapshot, or -1
+        int search(int target)
+        {
+            const vector<int>* snapshot = index->current.load(memory_order_acquire);
+            int result = IterativeJumpingBinarySearcher::search(*snapshot, target);
+
+            quiescent();
+            return result;
+        }
+
+        // Size of the snapshot this reader currently sees
+        size_t size()
+        {
+            size_t result = index->current.load(memory_order_acquire)->size();
+
+            quiescent();
+            return result;
+        }
+
+        // Stop holding reclamation back while idle; the next call to online() must precede further lookups
+        void offline()
+        {
+            slot->epoch.store(OFFLINE, memory_order_release);
+        }
+
+        void online()
+        {
+            slot->epoch.store(index->globalEpoch.load(memory_order_acquire), memory_order_seq_cst);
+
+            // Pairs with the fence in reclaim(): either the writer sees this slot, or our next pointer load sees the
+            // snapshot the writer published
+            atomic_thread_fence(memory_order_seq_cst);
+        }
+
+    private:
+        friend class SnapshotIndex;
+
+        SnapshotIndex* index;
+        ReaderSlot* slot;
+
+        Reader(SnapshotIndex* index, ReaderSlot* slot) : index(index), slot(slot)
+        {
+        }
+
+        // Plain load + store: announces that no snapshot pointer is held past this point
+        void quiescent()
+        {
+            slot->epoch.store(index->globalEpoch.load(memory_order_acquire), memory_order_release);
+        }
+    };
+
+    explicit SnapshotIndex(vector<int> keys, int maxReaders = 256) : slots(maxReaders)
+    {
+        MergeSorter::sort(keys);
+        current.store(new vector<int>(move(keys)), memory_order_release);
+    }
+
+    ~SnapshotIndex()
+    {
+        delete current.load();
+        for (const RetiredSnapshot& retired : retiredSnapshots) delete retired.snapshot;
+    }
+
+    SnapshotIndex(const SnapshotIndex&) = delete;
+    SnapshotIndex& operator=(const SnapshotIndex&) = delete;
+
+    // Called once per reader thread (not on the hot path); throws if every slot is taken
+    Reader registerReader()
+    {
+        for (ReaderSlot& slot : slots)
+        {
+            bool expected = false;
+            if (slot.inUse.compare_exchange_strong(expected, true))
+            {
+                Reader reader(this, &slot);
+                reader.online();
+                return reader;
+            }
+        }
+
+        throw runtime_error("SnapshotIndex: no free reader slots");
+    }
+
+    // Writer: sort the new table off to the side, swap it in, retire the old one
+    void publish(vector<int> keys)
+    {
+        MergeSorter::sort(keys);
+        const vector<int>* fresh = new vector<int>(move(keys));
+
+        lock_guard<mutex> lock(writerMutex);
+
+        const vector<int>* old = current.exchange(fresh, memory_order_seq_cst);
+        uint64_t retireEpoch = globalEpoch.fetch_add(1, memory_order_seq_cst) + 1;
+
+        retiredSnapshots.push_back({old, retireEpoch});
+        reclaim();
+    }
+
+    // Blocks until every retired snapshot has been freed (readers must keep making progress or go offline)
+    void synchronize()
+    {
+        while (true)
+        {
+            {
+                lock_guard<mutex> lock(writerMutex);
+                reclaim();
+                if (retiredSnapshots.empty()) return;
+            }
+            this_thread::yield();
+        }
+    }
+
+    size_t pendingReclamation()
+    {
+        lock_guard<mutex> lock(writerMutex);
+        return retiredSnapshots.size();
+    }
+
+private:
+    atomic<const vector<int>*> current{nullptr};
+    atomic<uint64_t> globalEpoch{0};
+    vector<ReaderSlot> slots;
+
+    mutex writerMutex;
+    vector<RetiredSnapshot> retiredSnapshots;
+
+    // Frees every retired snapshot that no online reader can still be using (writerMutex held)
+    void reclaim()
+    {
+        atomic_thread_fence(memory_order_seq_cst);
+
+        uint64_t oldestSeen = OFFLINE;
+        for (const ReaderSlot& slot : slots) oldestSeen = min(oldestSeen, slot.epoch.load(memory_order_acquire));
+
+        size_t kept = 0;
+        for (const RetiredSnapshot& retired : retiredSnapshots)
+        {
+            if (retired.epoch <= oldestSeen) delete retired.snapshot;
+            else retiredSnapshots[kept++] = retired;
+        }
+        retiredSnapshots.resize(kept);
+    }
+};
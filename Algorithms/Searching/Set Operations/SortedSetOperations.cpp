@@ -0,0 +1,149 @@
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <vector>
+
+#include "SortedSetOperations.h"
+
+using namespace std;
+
+// Posting list: `count` distinct sorted document IDs out of `universe`
+vector<int> makePostingList(size_t count, int universe, unsigned seed)
+{
+    mt19937 rng(seed);
+    uniform_int_distribution<int> id(0, universe - 1);
+
+    vector<int> list(count);
+    for (int& value : list) value = id(rng);
+
+    sort(list.begin(), list.end());
+    list.erase(unique(list.begin(), list.end()), list.end());
+    return list;
+}
+
+template <typename Function>
+double timeUs(Function function, int repetitions)
+{
+    auto start = chrono::steady_clock::now();
+    for (int r = 0; r < repetitions; r++) function();
+    return chrono::duration<double, micro>(chrono::steady_clock::now() - start).count() / repetitions;
+}
+
+void printArray(const int* values, size_t count, const string& label)
+{
+    cout << label << ": ";
+    for (size_t i = 0; i < count; i++) cout << setw(3) << values[i] << " ";
+    cout << endl;
+}
+
+int main()
+{
+    // Example 1: basic operations
+    vector<int> a = {1, 3, 5, 7, 9, 11, 13, 15};
+    vector<int> b = {2, 3, 5, 8, 13, 21};
+    vector<int> out(a.size() + b.size());
+
+    cout << "Example 1 - Set operations\n";
+    cout << "--------------------------\n";
+    printArray(out.data(), SortedSetOperations::intersect(a, b, out.data()), "a & b");
+    printArray(out.data(), SortedSetOperations::unite(a, b, out.data()), "a | b");
+    printArray(out.data(), SortedSetOperations::difference(a, b, out.data()), "a - b");
+    cout << endl;
+
+    // Every algorithm and every size ratio agrees with the standard library
+    for (size_t smallSize : {0, 1, 7, 100, 1000, 50000})
+    {
+        vector<int> small = makePostingList(smallSize, 1000000, 1);
+        vector<int> large = makePostingList(100000, 1000000, 2);
+
+        vector<int> expected;
+        set_intersection(small.begin(), small.end(), large.begin(), large.end(), back_inserter(expected));
+
+        vector<int> buffer(small.size() + large.size());
+        for (SetAlgorithm algorithm : {SetAlgorithm::Auto, SetAlgorithm::Linear, SetAlgorithm::Galloping, SetAlgorithm::Simd})
+        {
+            size_t count = SortedSetOperations::intersect(small, large, buffer.data(), algorithm);
+            assert(vector<int>(buffer.begin(), buffer.begin() + count) == expected);
+        }
+
+        expected.clear();
+        set_union(small.begin(), small.end(), large.begin(), large.end(), back_inserter(expected));
+        size_t count = SortedSetOperations::unite(small, large, buffer.data());
+        assert(vector<int>(buffer.begin(), buffer.begin() + count) == expected);
+
+        for (int direction = 0; direction < 2; direction++)
+        {
+            const vector<int>& x = direction == 0 ? small : large;
+            const vector<int>& y = direction == 0 ? large : small;
+
+            expected.clear();
+            set_difference(x.begin(), x.end(), y.begin(), y.end(), back_inserter(expected));
+            count = SortedSetOperations::difference(x, y, buffer.data());
+            assert(vector<int>(buffer.begin(), buffer.begin() + count) == expected);
+        }
+    }
+
+    // Two empty sets (null data pointers, null output): every operation returns 0 without touching memory
+    vector<int> none;
+    assert(SortedSetOperations::unite(none, none, nullptr) == 0);
+    assert(SortedSetOperations::intersect(none, none, nullptr) == 0);
+    assert(SortedSetOperations::difference(none, none, nullptr) == 0);
+
+    // Example 2: k-way intersection (a 3-term query)
+    vector<int> term1 = makePostingList(200000, 1000000, 3);
+    vector<int> term2 = makePostingList(50000, 1000000, 4);
+    vector<int> term3 = makePostingList(5000, 1000000, 5);
+
+    vector<int> expected;
+    vector<int> step;
+    set_intersection(term1.begin(), term1.end(), term2.begin(), term2.end(), back_inserter(step));
+    set_intersection(step.begin(), step.end(), term3.begin(), term3.end(), back_inserter(expected));
+
+    vector<int> result(term3.size());
+    size_t matches = SortedSetOperations::intersectMany({&term1, &term2, &term3}, result.data());
+    assert(vector<int>(result.begin(), result.begin() + matches) == expected);
+
+    cout << "Example 2 - 3-way intersection of 200000 / 50000 / 5000 IDs: " << matches << " matches\n\n";
+
+    // Example 3: timing by size ratio
+    cout << "Example 3 - Intersection time (us) by size ratio, large list = 1000000 IDs\n";
+    cout << "---------------------------------------------------------------------------\n";
+    cout << left << setw(10) << "small" << right << setw(16) << "binary search" << setw(10) << "linear" << setw(12) << "galloping" << setw(10)
+         << "simd" << setw(10) << "auto" << "\n";
+
+    vector<int> large = makePostingList(1000000, 4000000, 6);
+    vector<int> buffer(large.size());
+
+    for (size_t smallSize : {100, 10000, 250000, 1000000})
+    {
+        vector<int> small = makePostingList(smallSize, 4000000, 7);
+        int repetitions = smallSize >= 250000 ? 3 : 20;
+
+        double naive = timeUs(
+            [&]() {
+                size_t count = 0;
+                for (int value : small)
+                {
+                    if (IterativeHalvingBinarySearcher::search(large, value) != -1) buffer[count++] = value;
+                }
+            },
+            repetitions);
+
+        cout << left << setw(10) << small.size() << right << fixed << setprecision(1) << setw(16) << naive;
+        for (SetAlgorithm algorithm : {SetAlgorithm::Linear, SetAlgorithm::Galloping, SetAlgorithm::Simd, SetAlgorithm::Auto})
+        {
+            double us = timeUs([&]() { SortedSetOperations::intersect(small, large, buffer.data(), algorithm); }, repetitions);
+            cout << setw(algorithm == SetAlgorithm::Galloping ? 12 : 10) << us;
+        }
+        cout << "\n";
+    }
+
+    cout << "\nSIMD supported: " << (SortedSetOperations::simdSupported() ? "yes" : "no") << endl;
+    cout << "Assertion passed: all set operations match the standard library!" << endl;
+
+    return 0;
+}
@@ -0,0 +1,346 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define SORTED_SET_OPERATIONS_X86 1
+#endif
+
+#include "../Binary Search/IterativeBinarySearcher.h"
+
+using namespace std;
+
+/*
+    Sorted Set Operations (Inverted-Index Query Core):
+    - Inputs: sorted sets - strictly increasing int arrays (e.g. posting lists of document IDs)
+    - Output: written into a CALLER-PROVIDED buffer, the return value is the number of elements written
+        * intersect:     out needs room for min(|a|, |b|)
+        * unite:         out needs room for |a| + |b|
+        * difference:    out needs room for |a|            (a \ b)
+        * intersectMany: out needs room for the smallest list
+    - No allocations: the query path can reuse one buffer for every query
+
+    Choosing the algorithm by size ratio r = |large| / |small|:
+    1. Linear merge - O(|a| + |b|)
+        * Walk both lists like MergeSorter::merge; best when the lists are similar in size
+    2. Galloping (exponential search) - O(|small| * log r)
+        * For each small element: probe large[cursor + 1, 2, 4, 8, ...] until overshooting,
+          then findInsertionPoint inside that bracket
+        * Repeated IterativeHalvingBinarySearcher::search calls cost O(|small| * log |large|) instead: every search
+          restarts from index 0 and forgets where the previous one ended
+    3. SIMD block compare - O(|a| + |b|) with 4x fewer iterations (intersection only, x86 SSSE3)
+        * Compare 4 elements of a against all 4 rotations of 4 elements of b: 16 comparisons in 4 instructions
+        * Matches are packed together with a byte shuffle (lookup table indexed by the 4-bit match mask)
+        * Advance whichever block has the smaller last element (both if equal)
+
+    Auto selection: r >= 32 -> galloping, else SIMD when the CPU supports it, else linear.
+*/
+
+enum class SetAlgorithm
+{
+    Auto,
+    Linear,
+    Galloping,
+    Simd
+};
+
+class SortedSetOperations
+{
+public:
+    static const size_t GALLOPING_RATIO = 32;
+
+    static size_t intersect(const vector<int>& a, const vector<int>& b, int* out, SetAlgorithm algorithm = SetAlgorithm::Auto)
+    {
+        const vector<int>& small = a.size() <= b.size() ? a : b;
+        const vector<int>& large = a.size() <= b.size() ? b : a;
+
+        return intersect(small.data(), small.size(), large, out, algorithm);
+    }
+
+    static size_t unite(const vector<int>& a, const vector<int>& b, int* out)
+    {
+        const vector<int>& small = a.size() <= b.size() ? a : b;
+        const vector<int>& large = a.size() <= b.size() ? b : a;
+
+        if (small.empty() || large.size() / small.size() >= GALLOPING_RATIO) return uniteGalloping(small, large, out);
+
+        return uniteLinear(a, b, out);
+    }
+
+    // Elements of a that are not in b
+    static size_t difference(const vector<int>& a, const vector<int>& b, int* out)
+    {
+        if (!a.empty() && b.size() / a.size() >= GALLOPING_RATIO) return differenceGalloping(a, b, out);
+
+        return differenceLinear(a, b, out);
+    }
+
+    /*
+        k-way intersection:
+        - Start from the smallest list, then intersect the running result with each larger list in turn
+        - The running result only shrinks, so it is intersected IN PLACE inside `out`
+        - Each step re-picks the algorithm: the result is usually tiny next to the remaining lists -> galloping
+    */
+    static size_t intersectMany(vector<const vector<int>*> lists, int* out)
+    {
+        if (lists.empty()) return 0;
+
+        sort(lists.begin(), lists.end(), [](const vector<int>* x, const vector<int>* y) { return x->size() < y->size(); });
+
+        size_t count = lists[0]->size();
+        copy(lists[0]->begin(), lists[0]->end(), out);
+
+        for (size_t i = 1; i < lists.size() && count > 0; i++) count = intersect(out, count, *lists[i], out, SetAlgorithm::Auto);
+
+        return count;
+    }
+
+    static bool simdSupported()
+    {
+#ifdef SORTED_SET_OPERATIONS_X86
+        static const bool supported = __builtin_cpu_supports("ssse3");
+        return supported;
+#else
+        return false;
+#endif
+    }
+
+private:
+    // `out` may alias `small` (writes never overtake reads)
+    static size_t intersect(const int* small, size_t smallSize, const vector<int>& large, int* out, SetAlgorithm algorithm)
+    {
+        if (algorithm == SetAlgorithm::Auto)
+        {
+            if (smallSize == 0 || large.size() / smallSize >= GALLOPING_RATIO) algorithm = SetAlgorithm::Galloping;
+            else if (simdSupported()) algorithm = SetAlgorithm::Simd;
+            else algorithm = SetAlgorithm::Linear;
+        }
+
+        switch (algorithm)
+        {
+            case SetAlgorithm::Galloping:
+                return intersectGalloping(small, smallSize, large, out);
+            case SetAlgorithm::Simd:
+#ifdef SORTED_SET_OPERATIONS_X86
+                if (simdSupported()) return intersectSimd(small, smallSize, large.data(), large.size(), out);
+#endif
+                return intersectLinear(small, smallSize, large.data(), large.size(), out);
+            default:
+                return intersectLinear(small, smallSize, large.data(), large.size(), out);
+        }
+    }
+
+    static size_t intersectLinear(const int* a, size_t aSize, const int* b, size_t bSize, int* out)
+    {
+        size_t i = 0;
+        size_t j = 0;
+        size_t count = 0;
+
+        while (i < aSize && j < bSize)
+        {
+            if (a[i] < b[j]) i++;
+            else if (b[j] < a[i]) j++;
+            else
+            {
+                out[count++] = a[i];
+                i++;
+                j++;
+            }
+        }
+
+        return count;
+    }
+
+    // First index >= cursor in large whose element is >= target
+    static size_t gallop(const vector<int>& large, size_t cursor, int target)
+    {
+        size_t size = large.size();
+        size_t step = 1;
+
+        // Exponential probe: large[low] < target holds for every low we move to
+        size_t low = cursor;
+        if (low >= size || large[low] >= target) return low;
+
+        while (low + step < size && large[low + step] < target)
+        {
+            low += step;
+            step *= 2;
+        }
+
+        size_t high = min(low + step, size);
+        return IterativeHalvingBinarySearcher::findInsertionPoint(large, target, static_cast<int>(low) + 1, static_cast<int>(high));
+    }
+
+    static size_t intersectGalloping(const int* small, size_t smallSize, const vector<int>& large, int* out)
+    {
+        size_t cursor = 0;
+        size_t count = 0;
+
+        for (size_t i = 0; i < smallSize && cursor < large.size(); i++)
+        {
+            cursor = gallop(large, cursor, small[i]);
+
+            if (cursor < large.size() && large[cursor] == small[i]) out[count++] = small[i];
+        }
+
+        return count;
+    }
+
+#ifdef SORTED_SET_OPERATIONS_X86
+    // masks[mask] packs the lanes whose bit is set in `mask` to the front of the register
+    struct ShuffleTable
+    {
+        alignas(16) uint8_t masks[16][16];
+
+        ShuffleTable()
+        {
+            for (int mask = 0; mask < 16; mask++)
+            {
+                int out = 0;
+                for (int lane = 0; lane < 4; lane++)
+                {
+                    if (!(mask & (1 << lane))) continue;
+                    for (int byte = 0; byte < 4; byte++) masks[mask][out * 4 + byte] = static_cast<uint8_t>(lane * 4 + byte);
+                    out++;
+                }
+                for (int byte = out * 4; byte < 16; byte++) masks[mask][byte] = 0x80; // zero the unused tail
+            }
+        }
+    };
+
+    __attribute__((target("ssse3"))) static size_t intersectSimd(const int* a, size_t aSize, const int* b, size_t bSize, int* out)
+    {
+        static const ShuffleTable table;
+
+        size_t i = 0;
+        size_t j = 0;
+        size_t count = 0;
+
+        while (i + 4 <= aSize && j + 4 <= bSize)
+        {
+            __m128i va = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+            __m128i vb = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + j));
+
+            // a lanes vs b rotated by 0, 1, 2, 3 lanes: every pair (a[i+x], b[j+y]) gets compared once
+            __m128i match = _mm_cmpeq_epi32(va, vb);
+            match = _mm_or_si128(match, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(0, 3, 2, 1))));
+            match = _mm_or_si128(match, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(1, 0, 3, 2))));
+            match = _mm_or_si128(match, _mm_cmpeq_epi32(va, _mm_shuffle_epi32(vb, _MM_SHUFFLE(2, 1, 0, 3))));
+
+            int mask = _mm_movemask_ps(_mm_castsi128_ps(match));
+
+            // Read block ends before storing: `out` may alias `a` (k-way intersection works in place)
+            int aLast = a[i + 3];
+            int bLast = b[j + 3];
+
+            if (mask != 0)
+            {
+                // Pack matches, then copy only the matched lanes - never writes past the caller's buffer
+                alignas(16) int packed[4];
+                _mm_store_si128(reinterpret_cast<__m128i*>(packed),
+                                _mm_shuffle_epi8(va, _mm_load_si128(reinterpret_cast<const __m128i*>(table.masks[mask]))));
+
+                int matches = __builtin_popcount(mask);
+                memmove(out + count, packed, matches * sizeof(int));
+                count += matches;
+            }
+
+            if (aLast <= bLast) i += 4;
+            if (bLast <= aLast) j += 4;
+        }
+
+        return count + intersectLinear(a + i, aSize - i, b + j, bSize - j, out + count);
+    }
+#endif
+
+    static size_t uniteLinear(const vector<int>& a, const vector<int>& b, int* out)
+    {
+        size_t i = 0;
+        size_t j = 0;
+        size_t count = 0;
+
+        while (i < a.size() && j < b.size())
+        {
+            if (a[i] < b[j]) out[count++] = a[i++];
+            else if (b[j] < a[i]) out[count++] = b[j++];
+            else
+            {
+                out[count++] = a[i];
+                i++;
+                j++;
+            }
+        }
+
+        while (i < a.size()) out[count++] = a[i++];
+        while (j < b.size()) out[count++] = b[j++];
+
+        return count;
+    }
+
+    // Copies whole runs of `large` between consecutive small elements in one block copy each
+    static size_t uniteGalloping(const vector<int>& small, const vector<int>& large, int* out)
+    {
+        // Both empty (small is never the larger one): large.data() and out may be null, and memcpy forbids that
+        if (large.empty()) return 0;
+
+        size_t cursor = 0;
+        size_t count = 0;
+
+        for (int value : small)
+        {
+            size_t position = gallop(large, cursor, value);
+
+            memcpy(out + count, large.data() + cursor, (position - cursor) * sizeof(int));
+            count += position - cursor;
+            cursor = position;
+
+            out[count++] = value;
+            if (cursor < large.size() && large[cursor] == value) cursor++;
+        }
+
+        memcpy(out + count, large.data() + cursor, (large.size() - cursor) * sizeof(int));
+        return count + (large.size() - cursor);
+    }
+
+    static size_t differenceLinear(const vector<int>& a, const vector<int>& b, int* out)
+    {
+        size_t i = 0;
+        size_t j = 0;
+        size_t count = 0;
+
+        while (i < a.size() && j < b.size())
+        {
+            if (a[i] < b[j]) out[count++] = a[i++];
+            else if (b[j] < a[i]) j++;
+            else
+            {
+                i++;
+                j++;
+            }
+        }
+
+        while (i < a.size()) out[count++] = a[i++];
+
+        return count;
+    }
+
+    // a is much smaller than b: gallop through b for each element of a
+    static size_t differenceGalloping(const vector<int>& a, const vector<int>& b, int* out)
+    {
+        size_t cursor = 0;
+        size_t count = 0;
+
+        for (int value : a)
+        {
+            cursor = gallop(b, cursor, value);
+            if (cursor >= b.size() || b[cursor] != value) out[count++] = value;
+        }
+
+        return count;
+    }
+};
@@ -0,0 +1,90 @@
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include "LogStructuredSortedSet.h"
+
+using namespace std;
+
+template <typename Function>
+double timeMs(Function function)
+{
+    auto start = chrono::steady_clock::now();
+    function();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    mt19937 rng(42);
+    uniform_int_distribution<int> keyDistribution(0, 1 << 30);
+
+    // Example 1: small container with a tiny memtable, to show levels forming
+    LogStructuredSortedSet small(4, 4);
+    for (int key : {50, 10, 40, 20, 30, 60, 5, 45, 15, 25, 35, 55, 65, 1, 70, 2, 3, 80, 90, 75}) small.insert(key);
+
+    cout << "Example 1 - 20 inserts, memtable 4, fanout 4\n";
+    cout << "--------------------------------------------\n";
+    cout << "Levels: " << small.levelCount() << ", contains(45): " << small.contains(45) << ", contains(46): " << small.contains(46) << "\n";
+    vector<int> all = small.toSortedVector();
+    cout << "Sorted: ";
+    for (int key : all) cout << key << " ";
+    cout << "\n\n";
+    assert(is_sorted(all.begin(), all.end()) && all.size() == 20);
+
+    // Example 2: ingest rate vs sorted vector with findInsertionPoint
+    const size_t n = 200000;
+    vector<int> keys(n);
+    for (int& key : keys) key = keyDistribution(rng);
+
+    vector<int> sortedVector;
+    double vectorMs = timeMs([&]() {
+        for (int key : keys)
+        {
+            int position = IterativeHalvingBinarySearcher::findInsertionPoint(sortedVector, key);
+            sortedVector.insert(sortedVector.begin() + position, key);
+        }
+    });
+
+    LogStructuredSortedSet set;
+    double setMs = timeMs([&]() {
+        for (int key : keys) set.insert(key);
+    });
+
+    cout << "Example 2 - Inserting " << n << " random keys\n";
+    cout << "-------------------------------------\n";
+    cout << left << setw(40) << "sorted vector + findInsertionPoint" << right << fixed << setprecision(1) << setw(10) << vectorMs << " ms\n";
+    cout << left << setw(40) << "LogStructuredSortedSet" << right << setw(10) << setMs << " ms  (" << set.levelCount() << " levels)\n\n";
+
+    // Example 3: lookups (half hits, half misses) agree with the sorted vector
+    vector<int> queries(n);
+    for (size_t i = 0; i < n; i++) queries[i] = (i % 2 == 0) ? keys[i] : keyDistribution(rng);
+
+    size_t vectorHits = 0;
+    double vectorLookupMs = timeMs([&]() {
+        for (int query : queries) vectorHits += IterativeHalvingBinarySearcher::search(sortedVector, query) != -1;
+    });
+
+    size_t setHits = 0;
+    double setLookupMs = timeMs([&]() {
+        for (int query : queries) setHits += set.contains(query);
+    });
+
+    cout << "Example 3 - " << n << " lookups\n";
+    cout << "----------------------\n";
+    cout << left << setw(40) << "sorted vector" << right << setw(10) << vectorLookupMs << " ms\n";
+    cout << left << setw(40) << "LogStructuredSortedSet (fences)" << right << setw(10) << setLookupMs << " ms\n";
+
+    assert(vectorHits == setHits);
+    for (int query : queries) assert(set.contains(query) == (IterativeHalvingBinarySearcher::search(sortedVector, query) != -1));
+    assert(set.size() == n);
+    assert(set.toSortedVector() == sortedVector);
+
+    cout << "\nAssertion passed: lookups and full contents match the sorted vector!" << endl;
+
+    return 0;
+}
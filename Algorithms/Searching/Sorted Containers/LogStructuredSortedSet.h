@@ -0,0 +1,175 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "../../Sorting/Merge Sort/MergeSorter.h"
+#include "../Binary Search/IterativeBinarySearcher.h"
+
+using namespace std;
+
+/*
+    Log-Structured Sorted Set (LSM-style, sorted multiset of ints):
+    - Problem: a sorted vector<int> with insert at findInsertionPoint() shifts every later element
+        * O(n) memmove per insert -> inserting n keys costs O(n^2)
+    - Idea (the log-structured merge tree): never insert into big sorted arrays, only MERGE them
+        * New keys go into a small sorted memtable (cheap shifts: it holds at most a few hundred keys)
+        * A full memtable is merged into level 0 with MergeSorter's merge
+        * Level i holds up to memtableCapacity * fanout^(i+1) keys; an overfull level is merged into the next one
+        * Each key is re-merged about `fanout` times per level: O(fanout * log_fanout n) amortized moves per insert
+
+    Layout (memtableCapacity = 4, fanout = 4):
+        memtable: [ 17, 42 ]                                (sorted, mutable)
+        level 0:  [ 3, 8, 19, 25, 31, 40, 52, 60 ]          (sorted, immutable between merges, capacity 16)
+        level 1:  [ ... up to 64 keys ... ]                 (capacity 64)
+
+    Lookup:
+    - Check the memtable, then every level
+    - Fence pointers: each level keeps every 64th key in a small `fences` array
+        * findInsertionPoint over the fences picks ONE 64-key block - the fences of a big level stay in cache
+        * a second findInsertionPoint inside that block finishes the search (one or two cache lines)
+    - Cost: O(levels * log n) with ~log_fanout(n / memtableCapacity) levels
+
+    Compaction is amortized: it runs inside the insert() that overfills a level.
+*/
+
+class LogStructuredSortedSet
+{
+public:
+    explicit LogStructuredSortedSet(size_t memtableCapacity = 256, size_t fanout = 8)
+        : memtableCapacity(memtableCapacity < 1 ? 1 : memtableCapacity), fanout(fanout < 2 ? 2 : fanout)
+    {
+        memtable.reserve(this->memtableCapacity);
+    }
+
+    void insert(int key)
+    {
+        int position = IterativeHalvingBinarySearcher::findInsertionPoint(memtable, key);
+        memtable.insert(memtable.begin() + position, key);
+        totalSize++;
+
+        if (memtable.size() >= memtableCapacity) flush();
+    }
+
+    bool contains(int key) const
+    {
+        if (IterativeHalvingBinarySearcher::search(memtable, key) != -1) return true;
+
+        for (const Level& level : levels)
+        {
+            if (level.contains(key)) return true;
+        }
+
+        return false;
+    }
+
+    size_t size() const
+    {
+        return totalSize;
+    }
+
+    size_t levelCount() const
+    {
+        return levels.size();
+    }
+
+    // Every key in sorted order (merges all levels into one - a full compaction)
+    vector<int> toSortedVector()
+    {
+        flush();
+
+        for (size_t i = 0; i + 1 < levels.size(); i++) mergeLevelDown(i);
+
+        return levels.empty() ? vector<int>() : levels.back().keys;
+    }
+
+private:
+    static const int FENCE_STRIDE = 64;
+
+    struct Level
+    {
+        vector<int> keys;
+        vector<int> fences; // keys[0], keys[64], keys[128], ...
+
+        void rebuildFences()
+        {
+            fences.clear();
+            for (size_t i = 0; i < keys.size(); i += FENCE_STRIDE) fences.push_back(keys[i]);
+        }
+
+        bool contains(int key) const
+        {
+            if (keys.empty() || key < keys.front() || key > keys.back()) return false;
+
+            // First fence >= key: either an exact hit, or the key can only be in the block before it
+            int fence = IterativeHalvingBinarySearcher::findInsertionPoint(fences, key);
+            if (fence < static_cast<int>(fences.size()) && fences[fence] == key) return true;
+            if (fence == 0) return false;
+
+            int blockStart = (fence - 1) * FENCE_STRIDE;
+            int blockEnd = min(blockStart + FENCE_STRIDE, static_cast<int>(keys.size()));
+
+            int position = IterativeHalvingBinarySearcher::findInsertionPoint(keys, key, blockStart, blockEnd);
+            return position < blockEnd && keys[position] == key;
+        }
+    };
+
+    size_t memtableCapacity;
+    size_t fanout;
+    size_t totalSize = 0;
+
+    vector<int> memtable;
+    vector<Level> levels;
+    vector<int> scratch; // merge temporaries, reused across compactions
+
+    size_t levelCapacity(size_t level) const
+    {
+        size_t capacity = memtableCapacity * fanout;
+        for (size_t i = 0; i < level; i++) capacity *= fanout;
+        return capacity;
+    }
+
+    void flush()
+    {
+        if (memtable.empty()) return;
+
+        mergeInto(memtable, 0);
+        memtable.clear();
+
+        // Cascade: an overfull level is merged down into the next one
+        for (size_t i = 0; i < levels.size() && levels[i].keys.size() > levelCapacity(i); i++) mergeLevelDown(i);
+    }
+
+    void mergeLevelDown(size_t level)
+    {
+        // Create the target first: growing `levels` would invalidate a reference to levels[level].keys
+        if (level + 1 == levels.size()) levels.emplace_back();
+
+        mergeInto(levels[level].keys, level + 1);
+        levels[level].keys.clear();
+        levels[level].fences.clear();
+    }
+
+    // Merges the sorted run `source` into levels[target] (source keeps its contents)
+    void mergeInto(const vector<int>& source, size_t target)
+    {
+        if (source.empty()) return;
+        if (target == levels.size()) levels.emplace_back();
+
+        vector<int>& keys = levels[target].keys;
+        int oldSize = keys.size();
+
+        keys.insert(keys.end(), source.begin(), source.end());
+
+        if (oldSize > 0)
+        {
+            // keys[0..oldSize-1] and keys[oldSize..] are both sorted: one MergeSorter merge step
+            int newSize = keys.size();
+            if (scratch.size() < static_cast<size_t>(newSize)) scratch.resize(newSize);
+
+            MergeSorter::merge(keys, 0, oldSize - 1, newSize - 1, scratch.data(), scratch.data() + oldSize);
+        }
+
+        levels[target].rebuildFences();
+    }
+};
@@ -0,0 +1,251 @@
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+#include "../../Benchmarking/InputGenerators.h"
+#include "QuickSelector.h"
+
+using namespace std;
+
+void printArray(const vector<int>& arr, const string& label)
+{
+    cout << label << ": ";
+    for (int num : arr) cout << setw(3) << num << " ";
+    cout << endl;
+}
+
+// Key that counts every comparison made on it
+static long long keyComparisons = 0;
+
+struct CountedKey
+{
+    int value;
+};
+
+bool operator<(const CountedKey& a, const CountedKey& b)
+{
+    keyComparisons++;
+    return a.value < b.value;
+}
+
+bool operator<=(const CountedKey& a, const CountedKey& b)
+{
+    keyComparisons++;
+    return a.value <= b.value;
+}
+
+/*
+    McIlroy's adversary ("A Killer Adversary for Quicksort"): every element starts as "gas" (unknown, larger than
+    anything solid) and is frozen to the next smallest value only when a comparison forces it. Gas keeps losing the
+    pivot choice, so running the selection against it produces an input that defeats the median-of-three fast path.
+*/
+static vector<int> adversaryValues;
+static int adversaryGas = 0;
+static int adversarySolid = 0;
+static int adversaryCandidate = 0;
+
+struct AdversaryKey
+{
+    int index;
+};
+
+int adversaryCompare(const AdversaryKey& a, const AdversaryKey& b)
+{
+    int x = a.index;
+    int y = b.index;
+
+    if (adversaryValues[x] == adversaryGas && adversaryValues[y] == adversaryGas)
+    {
+        adversaryValues[x == adversaryCandidate ? x : y] = adversarySolid++;
+    }
+
+    if (adversaryValues[x] == adversaryGas) adversaryCandidate = x;
+    else if (adversaryValues[y] == adversaryGas) adversaryCandidate = y;
+
+    return adversaryValues[x] - adversaryValues[y];
+}
+
+bool operator<(const AdversaryKey& a, const AdversaryKey& b)
+{
+    return adversaryCompare(a, b) < 0;
+}
+
+bool operator<=(const AdversaryKey& a, const AdversaryKey& b)
+{
+    return adversaryCompare(a, b) <= 0;
+}
+
+vector<int> medianOfThreeKiller(int n, int k)
+{
+    adversaryValues.assign(n, n);
+    adversaryGas = n;
+    adversarySolid = 0;
+    adversaryCandidate = 0;
+
+    vector<AdversaryKey> keys(n);
+    for (int i = 0; i < n; i++) keys[i] = {i};
+    QuickSelector::nthElement(keys, k);
+
+    return adversaryValues;
+}
+
+// Comparisons nthElement needs on arr, divided by n
+double comparisonsPerElement(const vector<int>& arr, int k)
+{
+    vector<CountedKey> keys(arr.size());
+    for (size_t i = 0; i < arr.size(); i++) keys[i] = {arr[i]};
+
+    keyComparisons = 0;
+    QuickSelector::nthElement(keys, k);
+    return static_cast<double>(keyComparisons) / arr.size();
+}
+
+// Checks the nth_element contract against a fully sorted copy
+void checkSelection(vector<int> arr, int k)
+{
+    vector<int> sorted = arr;
+    std::sort(sorted.begin(), sorted.end());
+
+    int value = QuickSelector::nthElement(arr, k);
+    assert(value == sorted[k]);
+
+    for (int i = 0; i < k; i++) assert(arr[i] <= value);
+    for (size_t i = k + 1; i < arr.size(); i++) assert(arr[i] >= value);
+}
+
+int main()
+{
+    // Example 1: nth element
+    vector<int> arr1 = {9, 1, 8, 2, 7, 3, 6};
+    cout << "Example 1 - nthElement(k = 3)\n";
+    cout << "-----------------------------\n";
+    printArray(arr1, "Before");
+    int fourth = QuickSelector::nthElement(arr1, 3);
+    printArray(arr1, "After ");
+    cout << "4th smallest: " << fourth << "\n\n";
+    assert(fourth == 6);
+
+    // Example 2: partial sort (3 smallest)
+    vector<int> arr2 = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3};
+    cout << "Example 2 - partialSort(k = 3)\n";
+    cout << "------------------------------\n";
+    printArray(arr2, "Before");
+    QuickSelector::partialSort(arr2, 3);
+    printArray(arr2, "After ");
+    cout << endl;
+    assert(arr2[0] == 1 && arr2[1] == 1 && arr2[2] == 2);
+
+    // Example 3: streaming top-k over chunks
+    StreamingTopK<int> top(5);
+    cout << "Example 3 - Streaming top 5 over 100 chunks of 1000 values\n";
+    cout << "----------------------------------------------------------\n";
+    for (int chunk = 0; chunk < 100; chunk++)
+    {
+        vector<int> values = InputGenerator::generate(Distribution::Random, 1000, chunk);
+        for (int& v : values) v += chunk; // largest values come from the last chunks
+        top.pushChunk(values);
+    }
+    vector<int> largest = top.result();
+    printArray(largest, "Top 5 ");
+    cout << endl;
+
+    // Example 4: adversarial inputs stay correct (and linear) thanks to the introselect fallback
+    for (Distribution distribution : InputGenerator::all())
+    {
+        vector<int> arr = InputGenerator::generate(distribution, 5000);
+        for (int k : {0, 1, 2500, 4998, 4999}) checkSelection(arr, k);
+    }
+    checkSelection(vector<int>(5000, 7), 1234); // all equal
+
+    // Streaming result matches a full sort
+    vector<int> all;
+    StreamingTopK<int> top100(100);
+    for (int chunk = 0; chunk < 50; chunk++)
+    {
+        vector<int> values = InputGenerator::generate(Distribution::Zipf, 2000, chunk);
+        top100.pushChunk(values);
+        all.insert(all.end(), values.begin(), values.end());
+    }
+    std::sort(all.rbegin(), all.rend());
+    assert(top100.result() == vector<int>(all.begin(), all.begin() + 100));
+
+    // Example 5: median of 10^6 values - selection vs full sort
+    vector<int> data = InputGenerator::generate(Distribution::Random, 1000000);
+    vector<int> copy = data;
+
+    auto start = chrono::steady_clock::now();
+    int median = QuickSelector::percentile(copy, 50);
+    double selectMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    start = chrono::steady_clock::now();
+    QuickSorter::sort(data);
+    double sortMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+    cout << "Example 5 - p50 of 10^6 random values\n";
+    cout << "-------------------------------------\n";
+    cout << "QuickSelector::percentile: " << fixed << setprecision(1) << selectMs << " ms\n";
+    cout << "QuickSorter::sort:         " << sortMs << " ms\n";
+    assert(median == data[499999]);
+
+    // Example 6: inputs that defeat the fast path - comparisons must stay linear (a constant per element)
+    cout << "\nExample 6 - comparisons per element on hostile inputs\n";
+    cout << "-----------------------------------------------------\n";
+    for (int size : {10000, 100000, 1000000})
+    {
+        vector<int> allEqual(size, 7);
+        vector<int> killer = medianOfThreeKiller(size, size / 2);
+
+        double equalCost = comparisonsPerElement(allEqual, size / 2);
+        double killerCost = comparisonsPerElement(killer, size / 2);
+        cout << "n = " << setw(7) << size << ": all equal " << setw(6) << setprecision(1) << equalCost
+             << ", median-of-3 killer " << setw(6) << killerCost << "\n";
+
+        assert(equalCost < 20 && killerCost < 20);
+        checkSelection(killer, size / 2);
+    }
+
+    // Out-of-range k and empty input throw instead of reading outside the array
+    vector<int> small = {3, 1, 2};
+    vector<int> none;
+    int rejected = 0;
+    for (int k : {-1, 3})
+    {
+        try
+        {
+            QuickSelector::nthElement(small, k);
+        }
+        catch (const out_of_range&)
+        {
+            rejected++;
+        }
+    }
+    try
+    {
+        QuickSelector::percentile(none, 50);
+    }
+    catch (const out_of_range&)
+    {
+        rejected++;
+    }
+    try
+    {
+        QuickSelector::percentile(small, nan(""));
+    }
+    catch (const invalid_argument&)
+    {
+        rejected++;
+    }
+    assert(rejected == 4);
+
+    // Percentiles outside [0, 100] clamp to the extremes (huge values would overflow the rank cast)
+    assert(QuickSelector::percentile(small, -1e300) == 1 && QuickSelector::percentile(small, 1e300) == 3);
+
+    cout << "\nAssertion passed: selection matches sorted order on all distributions!" << endl;
+
+    return 0;
+}
@@ -0,0 +1,285 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../../Sorting/Merge Sort/MergeSorter.h"
+#include "../../Sorting/Quick Sort/QuickSorter.h"
+
+using namespace std;
+
+/*
+    Selection (Quickselect) Properties:
+    - Finds the k-th smallest element WITHOUT sorting everything
+    - Same partition step as QuickSorter, but only recurses into the ONE side that contains index k
+        * QuickSorter:  T(n) = 2T(n/2) + O(n) = O(n log n)
+        * Quickselect:  T(n) = T(n/2) + O(n)  = O(n)   (n + n/2 + n/4 + ... = 2n)
+    - Use cases: median, percentiles (p50/p99), top-k, "k closest" queries
+
+    Introselect (worst-case linear):
+    - Plain quickselect inherits QuickSorter's O(n^2) worst case when pivots are bad
+    - Fast path: median-of-three pivot, moved to arr[high] so QuickSorter::partition can be reused unchanged
+    - Progress check: every two fast-path partitions must at least halve the active range, otherwise switch to the
+      slow-but-safe path for good (a fixed budget of 2*log2(n) partitions would allow O(n log n): on all-equal input
+      each `<=` partition puts the pivot at arr[high] and removes a single element)
+        * Fast path total: at most 2 * (n + n/2 + n/4 + ...) = 4n partitioned elements before finishing or switching
+    - Safe path: median-of-medians pivot + three-way partition
+        * Median of medians (groups of 5) is guaranteed to be larger than ~30% and smaller than ~30% of elements
+        * Three-way partition (< pivot | == pivot | > pivot) stops duplicate-heavy input from shrinking the range by only 1
+        * Guarantees T(n) <= T(n/5) + T(7n/10) + O(n) = O(n)
+
+    Visualization: find k = 3 (4th smallest) in [9, 1, 8, 2, 7, 3, 6]
+    [9, 1, 8, 2, 7, 3, 6]   pivot 6 -> [1, 2, 3, 6, 7, 9, 8]   pivot lands at 3 == k -> done
+    Left of k: all <= 6, right of k: all >= 6, neither side sorted
+
+    Time Complexity: O(n) worst case
+    Space Complexity: O(1) extra (iterative), O(log n) for median-of-medians recursion
+*/
+
+class QuickSelector
+{
+public:
+    /*
+        nth_element: rearranges arr so that
+        - arr[k] holds the value it would have if arr were sorted
+        - everything before k is <= arr[k], everything after is >= arr[k]
+        Returns arr[k]. Throws out_of_range unless 0 <= k < n.
+    */
+    template <typename T>
+    static T nthElement(vector<T>& arr, int k)
+    {
+        int n = arr.size();
+        if (k < 0 || k >= n)
+        {
+            throw out_of_range("QuickSelector::nthElement: k = " + to_string(k) + " outside an array of " + to_string(n));
+        }
+
+        select(arr, 0, n - 1, k, false);
+
+        return arr[k];
+    }
+
+    // Puts the k smallest elements, in ascending order, at the front of arr (rest in unspecified order)
+    template <typename T>
+    static void partialSort(vector<T>& arr, int k)
+    {
+        int n = arr.size();
+        if (k <= 0 || n == 0) return;
+        if (k > n) k = n;
+
+        if (k < n) nthElement(arr, k - 1);
+
+        // The prefix is arbitrary-order output of quickselect - MergeSorter avoids QuickSorter's arr[high] worst case
+        vector<T> prefix(arr.begin(), arr.begin() + k);
+        MergeSorter::sort(prefix);
+
+        for (int i = 0; i < k; i++) arr[i] = prefix[i];
+    }
+
+    // Nearest-rank percentile, p in [0, 100] (clamped); reorders arr
+    // Throws invalid_argument on a NaN p, out_of_range on an empty array
+    template <typename T>
+    static T percentile(vector<T>& arr, double p)
+    {
+        if (isnan(p)) throw invalid_argument("QuickSelector::percentile: percentile is NaN");
+
+        int n = arr.size();
+        if (n == 0) throw out_of_range("QuickSelector::percentile: empty array");
+
+        // Clamp before the cast: converting an out-of-range double to an integer is undefined
+        p = min(max(p, 0.0), 100.0);
+
+        int rank = static_cast<int>(ceil(p / 100.0 * n)) - 1;
+
+        if (rank < 0) rank = 0;
+
+        return nthElement(arr, rank);
+    }
+
+private:
+    template <typename T>
+    static void select(vector<T>& arr, int low, int high, int k, bool safeOnly)
+    {
+        int checkpointSize = high - low + 1; // range size two fast partitions ago
+        int partitionsSinceCheckpoint = 0;
+
+        while (low < high)
+        {
+            if (!safeOnly)
+            {
+                // Fast path: median-of-three into arr[high], then QuickSorter's partition kernel
+                moveMedianOfThreeToHigh(arr, low, high);
+                int pivot = QuickSorter::partition(arr, low, high);
+
+                if (k == pivot) return;
+                if (k < pivot) high = pivot - 1;
+                else low = pivot + 1;
+
+                if (++partitionsSinceCheckpoint == 2)
+                {
+                    // Range not halved by the last two partitions: the pivots are bad, stop trusting them
+                    if (2 * (high - low + 1) > checkpointSize) safeOnly = true;
+
+                    checkpointSize = high - low + 1;
+                    partitionsSinceCheckpoint = 0;
+                }
+            }
+            else
+            {
+                // Safe path: median-of-medians pivot value + three-way partition
+                T pivotValue = arr[medianOfMedians(arr, low, high)];
+                pair<int, int> equalRange = partitionThreeWay(arr, low, high, pivotValue);
+
+                if (k < equalRange.first) high = equalRange.first - 1;
+                else if (k > equalRange.second) low = equalRange.second + 1;
+                else return; // k lands on a copy of the pivot
+            }
+        }
+    }
+
+    template <typename T>
+    static void moveMedianOfThreeToHigh(vector<T>& arr, int low, int high)
+    {
+        int mid = low + (high - low) / 2;
+
+        // Order arr[low] <= arr[mid] <= arr[high], then swap the median into the pivot slot
+        if (arr[mid] < arr[low]) swap(arr[mid], arr[low]);
+        if (arr[high] < arr[low]) swap(arr[high], arr[low]);
+        if (arr[high] < arr[mid]) swap(arr[high], arr[mid]);
+
+        swap(arr[mid], arr[high]);
+    }
+
+    // Returns the index of an element guaranteed to have ~30% of arr[low..high] on each side
+    template <typename T>
+    static int medianOfMedians(vector<T>& arr, int low, int high)
+    {
+        int n = high - low + 1;
+        if (n <= 5)
+        {
+            insertionSort(arr, low, high);
+            return low + (n - 1) / 2;
+        }
+
+        // Median of each group of 5, collected at the front of the range
+        int medians = 0;
+        for (int groupStart = low; groupStart <= high; groupStart += 5)
+        {
+            int groupEnd = min(groupStart + 4, high);
+            insertionSort(arr, groupStart, groupEnd);
+
+            swap(arr[low + medians], arr[groupStart + (groupEnd - groupStart) / 2]);
+            medians++;
+        }
+
+        // Median of the medians, found with the safe path only
+        int middle = low + (medians - 1) / 2;
+        select(arr, low, low + medians - 1, middle, true);
+
+        return middle;
+    }
+
+    // Dutch national flag: arr[low..lt-1] < pivot, arr[lt..gt] == pivot, arr[gt+1..high] > pivot
+    template <typename T>
+    static pair<int, int> partitionThreeWay(vector<T>& arr, int low, int high, T pivot)
+    {
+        int lt = low;
+        int i = low;
+        int gt = high;
+
+        while (i <= gt)
+        {
+            if (arr[i] < pivot) swap(arr[lt++], arr[i++]);
+            else if (pivot < arr[i]) swap(arr[i], arr[gt--]);
+            else i++;
+        }
+
+        return {lt, gt};
+    }
+
+    template <typename T>
+    static void insertionSort(vector<T>& arr, int low, int high)
+    {
+        for (int i = low + 1; i <= high; i++)
+        {
+            T value = arr[i];
+            int j = i - 1;
+
+            while (j >= low && value < arr[j])
+            {
+                arr[j + 1] = arr[j];
+                j--;
+            }
+
+            arr[j + 1] = value;
+        }
+    }
+};
+
+/*
+    Streaming Top-K (largest k values over chunked input):
+    - Input arrives in chunks and never fits in memory at once
+    - Keep a buffer of up to 2k candidates; when it fills, quickselect it down to the k largest
+        * Each compaction costs O(2k) and frees k slots -> O(1) amortized per value
+        * A bounded heap would cost O(log k) per value instead
+    - threshold = smallest value kept after the last compaction; anything <= threshold can never enter the top k
+
+    Time Complexity: O(n) for n streamed values, O(k log k) for the final sorted result
+    Space Complexity: O(k)
+*/
+template <typename T>
+class StreamingTopK
+{
+public:
+    explicit StreamingTopK(int k) : k(k)
+    {
+        buffer.reserve(2 * k);
+    }
+
+    void push(const T& value)
+    {
+        if (k <= 0) return;
+        if (hasThreshold && value <= threshold) return;
+
+        buffer.push_back(value);
+        if (static_cast<int>(buffer.size()) == 2 * k) compact();
+    }
+
+    void pushChunk(const vector<T>& chunk)
+    {
+        for (const T& value : chunk) push(value);
+    }
+
+    // The k largest values seen so far, largest first
+    vector<T> result()
+    {
+        compact();
+
+        vector<T> top = buffer;
+        MergeSorter::sort(top);
+
+        return vector<T>(top.rbegin(), top.rend());
+    }
+
+private:
+    int k;
+    vector<T> buffer;
+    T threshold = T();
+    bool hasThreshold = false;
+
+    void compact()
+    {
+        int excess = static_cast<int>(buffer.size()) - k;
+        if (excess <= 0) return;
+
+        // After selection, buffer[excess..] are the k largest
+        threshold = QuickSelector::nthElement(buffer, excess);
+        hasThreshold = true;
+
+        buffer.erase(buffer.begin(), buffer.begin() + excess);
+    }
+};
@@ -0,0 +1,175 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "../Merge Sort/MergeSorter.h"
+#include "../Non-Comparison Element Count/CountingSorter.h"
+#include "../Quick Sort/QuickSorter.h"
+#include "../Sorter Context/SorterContext.h"
+
+using namespace std;
+
+/*
+    Indirect (Key-Pointer) Sorting:
+    - Problem: records are 64-256 bytes but sorted by one int field
+        * QuickSorter swaps whole elements, MergeSorter copies whole elements into leftArr/rightArr and back
+        * Every compare-and-move drags the full record through the cache, even though only 4 bytes decide the order
+    - Idea: sort small (key, index) pairs instead of the records
+        * A KeyIndex is 8 bytes - a 128-byte record costs 16x more memory traffic per move
+        * The sorted pairs ARE the answer: order[p] = index of the record that belongs at position p
+
+    Two ways to use the result:
+    1. argsort():          return the permutation and never move the records at all (read them through order[])
+    2. sortByKey():        argsort, then permute the records in ONE final pass - each record is moved exactly once
+
+    Stability:
+    - KeyIndex compares by key, then by original index, so no two pairs are ever equal
+    - Result: even QuickSorter (normally unstable) produces the stable order
+
+    Strategies:
+    - Quick:    QuickSorter's partition on KeyIndex pairs, with a median-of-three pivot and recursion into the
+                smaller side only: pairs are all distinct, so sorted and reversed keys split evenly, and the stack
+                stays O(log n) whatever the pivots do
+    - Merge:    MergeSorter on KeyIndex pairs, O(n log n) guaranteed
+    - Counting: CountingSorter's radix argsort on the keys alone (4 stable byte passes carrying the index), O(n)
+
+    Example:
+        records (key):  [ 30, 10, 20, 10 ]
+        pairs:          (30,0) (10,1) (20,2) (10,3)
+        sorted pairs:   (10,1) (10,3) (20,2) (30,0)
+        order:          [ 1, 3, 2, 0 ]
+*/
+
+struct KeyIndex
+{
+    int key;
+    int index;
+};
+
+inline bool operator<=(const KeyIndex& a, const KeyIndex& b)
+{
+    return a.key < b.key || (a.key == b.key && a.index <= b.index);
+}
+
+enum class IndirectStrategy
+{
+    Quick,
+    Merge,
+    Counting
+};
+
+class IndirectSorter
+{
+public:
+    // keyOf(record) -> int sort key
+    template <typename Record, typename KeyOf>
+    static vector<int> argsort(const vector<Record>& records, KeyOf keyOf, IndirectStrategy strategy = IndirectStrategy::Merge)
+    {
+        if (strategy == IndirectStrategy::Counting)
+        {
+            vector<int> keys(records.size());
+            for (size_t i = 0; i < records.size(); i++) keys[i] = keyOf(records[i]);
+
+            SorterContext context;
+            return CountingSorter::argsort(keys, context);
+        }
+
+        vector<KeyIndex> pairs(records.size());
+        for (size_t i = 0; i < records.size(); i++) pairs[i] = {keyOf(records[i]), static_cast<int>(i)};
+
+        if (strategy == IndirectStrategy::Quick) quickSort(pairs, 0, static_cast<int>(pairs.size()) - 1);
+        else MergeSorter::sort(pairs);
+
+        vector<int> order(pairs.size());
+        for (size_t i = 0; i < pairs.size(); i++) order[i] = pairs[i].index;
+
+        return order;
+    }
+
+    /*
+        Apply a permutation in place by following its cycles:
+        - Position i should receive records[order[i]]
+        - Walk each cycle once: lift the first record out, pull every other record of the cycle forward, drop the lifted one in last
+        - Each record is moved exactly once (plus one temporary per cycle); extra memory is one bit per record
+    */
+    template <typename Record>
+    static void applyPermutation(vector<Record>& records, const vector<int>& order)
+    {
+        vector<bool> placed(records.size(), false);
+
+        for (size_t start = 0; start < records.size(); start++)
+        {
+            if (placed[start]) continue;
+
+            if (static_cast<size_t>(order[start]) == start)
+            {
+                placed[start] = true;
+                continue;
+            }
+
+            Record lifted = move(records[start]);
+            size_t current = start;
+
+            while (true)
+            {
+                size_t source = order[current];
+                placed[current] = true;
+
+                if (source == start)
+                {
+                    records[current] = move(lifted);
+                    break;
+                }
+
+                records[current] = move(records[source]);
+                current = source;
+            }
+        }
+    }
+
+    template <typename Record, typename KeyOf>
+    static void sortByKey(vector<Record>& records, KeyOf keyOf, IndirectStrategy strategy = IndirectStrategy::Merge)
+    {
+        vector<int> order = argsort(records, keyOf, strategy);
+        applyPermutation(records, order);
+    }
+
+private:
+    static const int INSERTION_SORT_SIZE = 16;
+
+    static void quickSort(vector<KeyIndex>& pairs, int low, int high)
+    {
+        while (high - low + 1 > INSERTION_SORT_SIZE)
+        {
+            moveMedianOfThreeToHigh(pairs, low, high);
+            int pivot = QuickSorter::partition(pairs, low, high);
+
+            // Smaller side by recursion, larger side by looping: at most log2(n) frames
+            if (pivot - low < high - pivot)
+            {
+                quickSort(pairs, low, pivot - 1);
+                low = pivot + 1;
+            }
+            else
+            {
+                quickSort(pairs, pivot + 1, high);
+                high = pivot - 1;
+            }
+        }
+
+        QuickSorter::insertionSort(pairs, low, high);
+    }
+
+    // Order pairs[low] <= pairs[mid] <= pairs[high], then swap the median into the pivot slot partition() uses
+    static void moveMedianOfThreeToHigh(vector<KeyIndex>& pairs, int low, int high)
+    {
+        int mid = low + (high - low) / 2;
+
+        if (!(pairs[low] <= pairs[mid])) swap(pairs[low], pairs[mid]);
+        if (!(pairs[low] <= pairs[high])) swap(pairs[low], pairs[high]);
+        if (!(pairs[mid] <= pairs[high])) swap(pairs[mid], pairs[high]);
+
+        swap(pairs[mid], pairs[high]);
+    }
+};
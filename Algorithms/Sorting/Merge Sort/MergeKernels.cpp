@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <climits>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "MergeKernels.h"
+#include "MergeSorter.h"
+
+using namespace std;
+
+const vector<pair<MergeKernel, string>> KERNELS = {
+    {MergeKernel::Scalar, "branchless scalar"},
+    {MergeKernel::Sse41, "SSE4.1 (4 lanes)"},
+    {MergeKernel::Avx2, "AVX2 (8 lanes)"},
+    {MergeKernel::Avx512, "AVX-512 (16 lanes)"},
+};
+
+vector<int> sortedRun(size_t n, int low, int high, mt19937& rng)
+{
+    uniform_int_distribution<int> value(low, high);
+    vector<int> run(n);
+    for (int& x : run) x = value(rng);
+    sort(run.begin(), run.end());
+    return run;
+}
+
+// Element that remembers its original position, to check stability
+struct StableItem
+{
+    int key;
+    int position;
+};
+
+bool operator<=(const StableItem& a, const StableItem& b)
+{
+    return a.key <= b.key;
+}
+
+int main()
+{
+    // Example 1: the visualization from MergeKernels.h
+    vector<int> a = {1, 4, 6, 9};
+    vector<int> b = {2, 3, 7, 8};
+    vector<int> merged(8);
+    MergeKernels::merge(a.data(), a.size(), b.data(), b.size(), merged.data(), MergeKernel::Sse41);
+
+    cout << "Example 1 - [1, 4, 6, 9] + [2, 3, 7, 8]\n";
+    cout << "---------------------------------------\n";
+    for (int value : merged) cout << value << " ";
+    cout << "\n";
+    assert(merged == vector<int>({1, 2, 3, 4, 6, 7, 8, 9}));
+
+    // Every kernel against std::merge: sizes around the lane widths, heavy duplicates, INT_MIN / INT_MAX
+    mt19937 rng(42);
+    for (const auto& [kernel, name] : KERNELS)
+    {
+        if (!MergeKernels::supported(kernel)) continue;
+
+        for (size_t leftSize : {0, 1, 3, 4, 7, 8, 15, 16, 17, 33, 100, 1000})
+        {
+            for (size_t rightSize : {0, 1, 4, 5, 8, 16, 31, 64, 257})
+            {
+                for (auto [low, high] : {pair<int, int>(0, 3), pair<int, int>(-1000, 1000), pair<int, int>(INT_MIN, INT_MAX)})
+                {
+                    vector<int> leftRun = sortedRun(leftSize, low, high, rng);
+                    vector<int> rightRun = sortedRun(rightSize, low, high, rng);
+
+                    vector<int> expected(leftSize + rightSize);
+                    merge(leftRun.begin(), leftRun.end(), rightRun.begin(), rightRun.end(), expected.begin());
+
+                    vector<int> out(leftSize + rightSize);
+                    MergeKernels::merge(leftRun.data(), leftSize, rightRun.data(), rightSize, out.data(), kernel);
+                    assert(out == expected);
+                }
+            }
+        }
+    }
+
+    // Non-int elements take the branchless scalar kernel: ties keep the left element first (stable)
+    vector<StableItem> leftItems;
+    vector<StableItem> rightItems;
+    for (int i = 0; i < 1000; i++) leftItems.push_back({i / 10, i});
+    for (int i = 0; i < 1000; i++) rightItems.push_back({i / 7, 1000 + i});
+    vector<StableItem> items(2000);
+    MergeKernels::merge(leftItems.data(), leftItems.size(), rightItems.data(), rightItems.size(), items.data());
+    for (size_t i = 1; i < items.size(); i++)
+    {
+        assert(items[i - 1].key <= items[i].key);
+        if (items[i - 1].key == items[i].key) assert(items[i - 1].position < items[i].position);
+    }
+
+    // MergeSorter (which now merges through the dispatched kernel) still sorts and stays stable
+    vector<StableItem> unsorted(100000);
+    for (int i = 0; i < static_cast<int>(unsorted.size()); i++) unsorted[i] = {static_cast<int>(rng() % 100), i};
+    MergeSorter::sort(unsorted);
+    for (size_t i = 1; i < unsorted.size(); i++)
+    {
+        assert(unsorted[i - 1].key <= unsorted[i].key);
+        if (unsorted[i - 1].key == unsorted[i].key) assert(unsorted[i - 1].position < unsorted[i].position);
+    }
+
+    vector<int> numbers = sortedRun(1 << 20, INT_MIN, INT_MAX, rng);
+    shuffle(numbers.begin(), numbers.end(), rng);
+    vector<int> expected = numbers;
+    sort(expected.begin(), expected.end());
+    MergeSorter::sort(numbers);
+    assert(numbers == expected);
+
+    // Example 2: throughput of one large merge per kernel
+    size_t n = 1 << 22;
+    vector<int> bigLeft = sortedRun(n, INT_MIN, INT_MAX, rng);
+    vector<int> bigRight = sortedRun(n, INT_MIN, INT_MAX, rng);
+    vector<int> reference(2 * n);
+    merge(bigLeft.begin(), bigLeft.end(), bigRight.begin(), bigRight.end(), reference.begin());
+
+    cout << "\nExample 2 - merging two sorted runs of " << n << " random ints\n";
+    cout << "------------------------------------------------------\n";
+
+    vector<int> out(2 * n);
+    auto start = chrono::steady_clock::now();
+    merge(bigLeft.begin(), bigLeft.end(), bigRight.begin(), bigRight.end(), out.begin());
+    double stdMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << left << setw(24) << "std::merge" << right << fixed << setprecision(1) << setw(8) << stdMs << " ms\n";
+
+    for (const auto& [kernel, name] : KERNELS)
+    {
+        if (!MergeKernels::supported(kernel))
+        {
+            cout << left << setw(24) << name << right << setw(11) << "n/a" << "\n";
+            continue;
+        }
+
+        start = chrono::steady_clock::now();
+        MergeKernels::merge(bigLeft.data(), n, bigRight.data(), n, out.data(), kernel);
+        double ms = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        assert(out == reference);
+
+        cout << left << setw(24) << name << right << setw(8) << ms << " ms   " << setprecision(2) << stdMs / ms
+             << "x\n" << setprecision(1);
+    }
+
+    cout << "\nAssertion passed: every merge kernel matches std::merge, and MergeSorter stays stable!" << endl;
+
+    return 0;
+}
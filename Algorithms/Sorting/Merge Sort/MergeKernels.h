@@ -0,0 +1,344 @@
+#pragma once
+
+#include <climits>
+#include <cstddef>
+#include <type_traits>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define MERGE_KERNELS_X86 1
+#endif
+
+#include "../../Instrumentation/Instrumentation.h"
+
+using namespace std;
+
+/*
+    Merge Kernels (the inner loop of MergeSorter::merge):
+    - Scalar merge: `if (leftArr[i] <= rightArr[j])` for EVERY output element
+        * On random input that branch is a coin flip: ~50% mispredictions, ~15 cycles each
+    - Two fixes, picked at runtime:
+
+    1. Branchless scalar (any T, stable):
+           takeLeft = left[i] <= right[j]
+           out[k++] = takeLeft ? left[i] : right[j]      // conditional move, no jump
+           i += takeLeft;  j += !takeLeft
+       Ties take the left element, exactly like the original loop -> MergeSorter stays stable
+
+    2. Bitonic merge network in registers (int only, W = 4 / 8 / 16 lanes with SSE4.1 / AVX2 / AVX-512):
+           a = [1, 4, 6, 9]   b = [2, 3, 7, 8]           two sorted vectors
+           reverse b          -> [8, 7, 3, 2]            a ++ reverse(b) is bitonic (up, then down)
+           min / max          -> L = [1, 4, 3, 2]   H = [8, 7, 6, 9]
+                                 every L <= every H, and L, H are bitonic again
+           half-cleaners at distance 2, 1 on each   -> L = [1, 2, 3, 4]   H = [6, 7, 8, 9]
+       - log2(W) + 1 min/max steps merge 2W elements with NO data-dependent branches
+       - Streaming: output L, keep H, load the next W elements from whichever input has the smaller head,
+         merge them with H again (one branch per W elements instead of per element)
+       - Equal ints are indistinguishable, so reordering ties cannot break stability. Every other element type
+         (KeyIndex, StableItem, ...) uses the stable branchless scalar kernel.
+
+    Dispatch: the widest kernel the CPU supports (__builtin_cpu_supports), checked once.
+
+    Instrumentation (-DALGORITHMS_INSTRUMENTATION) counts what the dispatched kernel really does: one comparison per
+    scalar decision, W * (log2(W) + 1) per bitonic merge of 2W elements (one per lane per compare-exchange stage)
+*/
+
+enum class MergeKernel
+{
+    Auto,
+    Scalar,
+    Sse41,
+    Avx2,
+    Avx512
+};
+
+class MergeKernels
+{
+public:
+    // Merges sorted left[0..leftSize) and right[0..rightSize) into out (which must not overlap either input)
+    template <typename T>
+    static void merge(const T* left, size_t leftSize, const T* right, size_t rightSize, T* out,
+                      MergeKernel kernel = MergeKernel::Auto)
+    {
+#ifdef MERGE_KERNELS_X86
+        if constexpr (is_same<T, int>::value)
+        {
+            if (kernel == MergeKernel::Auto) kernel = bestKernel();
+
+            if (kernel == MergeKernel::Avx512 && leftSize >= 16 && rightSize >= 16 && supported(MergeKernel::Avx512))
+            {
+                mergeAvx512(left, leftSize, right, rightSize, out);
+                return;
+            }
+            if (kernel == MergeKernel::Avx2 && leftSize >= 8 && rightSize >= 8 && supported(MergeKernel::Avx2))
+            {
+                mergeAvx2(left, leftSize, right, rightSize, out);
+                return;
+            }
+            if (kernel == MergeKernel::Sse41 && leftSize >= 4 && rightSize >= 4 && supported(MergeKernel::Sse41))
+            {
+                mergeSse41(left, leftSize, right, rightSize, out);
+                return;
+            }
+        }
+#endif
+        mergeScalar(left, 0, leftSize, right, 0, rightSize, out);
+    }
+
+    static bool supported(MergeKernel kernel)
+    {
+#ifdef MERGE_KERNELS_X86
+        static const bool sse41 = __builtin_cpu_supports("sse4.1");
+        static const bool avx2 = __builtin_cpu_supports("avx2");
+        static const bool avx512 = __builtin_cpu_supports("avx512f");
+
+        switch (kernel)
+        {
+            case MergeKernel::Sse41:
+                return sse41;
+            case MergeKernel::Avx2:
+                return avx2;
+            case MergeKernel::Avx512:
+                return avx512;
+            default:
+                return true;
+        }
+#else
+        return kernel == MergeKernel::Auto || kernel == MergeKernel::Scalar;
+#endif
+    }
+
+    static MergeKernel bestKernel()
+    {
+        if (supported(MergeKernel::Avx512)) return MergeKernel::Avx512;
+        if (supported(MergeKernel::Avx2)) return MergeKernel::Avx2;
+        if (supported(MergeKernel::Sse41)) return MergeKernel::Sse41;
+        return MergeKernel::Scalar;
+    }
+
+private:
+    // Branchless two-way merge of left[i..leftSize) and right[j..rightSize); ties take the left element
+    template <typename T>
+    static void mergeScalar(const T* left, size_t i, size_t leftSize, const T* right, size_t j, size_t rightSize, T* out)
+    {
+        size_t k = 0;
+
+        while (i < leftSize && j < rightSize)
+        {
+            INSTRUMENT_COMPARISON();
+            bool takeLeft = left[i] <= right[j];
+            out[k++] = takeLeft ? left[i] : right[j];
+            i += takeLeft;
+            j += !takeLeft;
+        }
+
+        while (i < leftSize) out[k++] = left[i++];
+        while (j < rightSize) out[k++] = right[j++];
+    }
+
+    // Lane comparisons in one bitonic merge of two W-lane vectors: log2(W) + 1 stages of W compare-exchanges
+    static constexpr int networkComparisons(int width)
+    {
+        int stages = 1;
+        for (int lanes = width; lanes > 1; lanes /= 2) stages++;
+        return width * stages;
+    }
+
+    /*
+        After the vector loop: `high` (W sorted ints, already taken from the inputs) plus the two unread tails.
+        Three-way merge until `high` is used up, then an ordinary two-way merge of the tails.
+    */
+    static void finish(const int* high, int width, const int* left, size_t i, size_t leftSize, const int* right,
+                       size_t j, size_t rightSize, int* out)
+    {
+        size_t k = 0;
+        int h = 0;
+
+        while (h < width)
+        {
+            INSTRUMENT_COMPARISON();
+            if (i < leftSize && left[i] <= high[h] && (j >= rightSize || left[i] <= right[j])) out[k++] = left[i++];
+            else if (j < rightSize && right[j] < high[h]) out[k++] = right[j++];
+            else out[k++] = high[h++];
+        }
+
+        mergeScalar(left, i, leftSize, right, j, rightSize, out + k);
+    }
+
+#ifdef MERGE_KERNELS_X86
+    // SSE4.1: 4 lanes. Half-cleaner at distance d: compare lane x with lane x ^ d, lanes with bit d set keep the max
+    __attribute__((target("sse4.1"))) static void bitonicMerge(__m128i a, __m128i b, __m128i& low, __m128i& high)
+    {
+        b = _mm_shuffle_epi32(b, _MM_SHUFFLE(0, 1, 2, 3));
+        __m128i l = _mm_min_epi32(a, b);
+        __m128i h = _mm_max_epi32(a, b);
+
+        __m128i lx = _mm_shuffle_epi32(l, _MM_SHUFFLE(1, 0, 3, 2));
+        __m128i hx = _mm_shuffle_epi32(h, _MM_SHUFFLE(1, 0, 3, 2));
+        l = _mm_blend_epi16(_mm_min_epi32(l, lx), _mm_max_epi32(l, lx), 0xF0);
+        h = _mm_blend_epi16(_mm_min_epi32(h, hx), _mm_max_epi32(h, hx), 0xF0);
+
+        lx = _mm_shuffle_epi32(l, _MM_SHUFFLE(2, 3, 0, 1));
+        hx = _mm_shuffle_epi32(h, _MM_SHUFFLE(2, 3, 0, 1));
+        low = _mm_blend_epi16(_mm_min_epi32(l, lx), _mm_max_epi32(l, lx), 0xCC);
+        high = _mm_blend_epi16(_mm_min_epi32(h, hx), _mm_max_epi32(h, hx), 0xCC);
+    }
+
+    __attribute__((target("sse4.1"))) static void mergeSse41(const int* left, size_t leftSize, const int* right,
+                                                             size_t rightSize, int* out)
+    {
+        const int W = 4;
+        __m128i low;
+        __m128i high;
+        bitonicMerge(_mm_loadu_si128(reinterpret_cast<const __m128i*>(left)),
+                     _mm_loadu_si128(reinterpret_cast<const __m128i*>(right)), low, high);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), low);
+        INSTRUMENT_COMPARISONS(networkComparisons(W));
+
+        size_t i = W;
+        size_t j = W;
+        size_t k = W;
+
+        while (i + W <= leftSize && j + W <= rightSize)
+        {
+            // One (predictable-ish) decision per W elements, taken without a jump
+            INSTRUMENT_COMPARISONS(1 + networkComparisons(W));
+            bool takeLeft = left[i] <= right[j];
+            const int* next = takeLeft ? left + i : right + j;
+            i += takeLeft ? W : 0;
+            j += takeLeft ? 0 : W;
+
+            bitonicMerge(_mm_loadu_si128(reinterpret_cast<const __m128i*>(next)), high, low, high);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + k), low);
+            k += W;
+        }
+
+        alignas(16) int rest[W];
+        _mm_store_si128(reinterpret_cast<__m128i*>(rest), high);
+        finish(rest, W, left, i, leftSize, right, j, rightSize, out + k);
+    }
+
+    // AVX2: 8 lanes; distance 4 crosses the 128-bit halves (permute2x128), distances 2 and 1 stay inside them
+    __attribute__((target("avx2"))) static void bitonicMerge(__m256i a, __m256i b, __m256i& low, __m256i& high)
+    {
+        b = _mm256_permutevar8x32_epi32(b, _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+        __m256i l = _mm256_min_epi32(a, b);
+        __m256i h = _mm256_max_epi32(a, b);
+
+        __m256i lx = _mm256_permute2x128_si256(l, l, 1);
+        __m256i hx = _mm256_permute2x128_si256(h, h, 1);
+        l = _mm256_blend_epi32(_mm256_min_epi32(l, lx), _mm256_max_epi32(l, lx), 0xF0);
+        h = _mm256_blend_epi32(_mm256_min_epi32(h, hx), _mm256_max_epi32(h, hx), 0xF0);
+
+        lx = _mm256_shuffle_epi32(l, _MM_SHUFFLE(1, 0, 3, 2));
+        hx = _mm256_shuffle_epi32(h, _MM_SHUFFLE(1, 0, 3, 2));
+        l = _mm256_blend_epi32(_mm256_min_epi32(l, lx), _mm256_max_epi32(l, lx), 0xCC);
+        h = _mm256_blend_epi32(_mm256_min_epi32(h, hx), _mm256_max_epi32(h, hx), 0xCC);
+
+        lx = _mm256_shuffle_epi32(l, _MM_SHUFFLE(2, 3, 0, 1));
+        hx = _mm256_shuffle_epi32(h, _MM_SHUFFLE(2, 3, 0, 1));
+        low = _mm256_blend_epi32(_mm256_min_epi32(l, lx), _mm256_max_epi32(l, lx), 0xAA);
+        high = _mm256_blend_epi32(_mm256_min_epi32(h, hx), _mm256_max_epi32(h, hx), 0xAA);
+    }
+
+    __attribute__((target("avx2"))) static void mergeAvx2(const int* left, size_t leftSize, const int* right,
+                                                          size_t rightSize, int* out)
+    {
+        const int W = 8;
+        __m256i low;
+        __m256i high;
+        bitonicMerge(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(left)),
+                     _mm256_loadu_si256(reinterpret_cast<const __m256i*>(right)), low, high);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), low);
+        INSTRUMENT_COMPARISONS(networkComparisons(W));
+
+        size_t i = W;
+        size_t j = W;
+        size_t k = W;
+
+        while (i + W <= leftSize && j + W <= rightSize)
+        {
+            INSTRUMENT_COMPARISONS(1 + networkComparisons(W));
+            bool takeLeft = left[i] <= right[j];
+            const int* next = takeLeft ? left + i : right + j;
+            i += takeLeft ? W : 0;
+            j += takeLeft ? 0 : W;
+
+            bitonicMerge(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(next)), high, low, high);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + k), low);
+            k += W;
+        }
+
+        alignas(32) int rest[W];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(rest), high);
+        finish(rest, W, left, i, leftSize, right, j, rightSize, out + k);
+    }
+
+    /*
+        AVX-512: 16 lanes; every distance is one permutexvar, and the min/max of a half-cleaner go straight into
+        their lanes through the mask (no separate blend)
+        - Only the merge-masked forms are used: they take an explicit pass-through vector, whereas GCC's unmasked
+          wrappers pass _mm512_undefined_epi32() and trip -Wuninitialized in every includer
+    */
+    __attribute__((target("avx512f"))) static __m512i halfClean(__m512i x, __m512i partner, __mmask16 keepMax)
+    {
+        __m512i other = _mm512_mask_permutexvar_epi32(x, 0xFFFF, partner, x);
+        __m512i result = _mm512_mask_min_epi32(x, static_cast<__mmask16>(~keepMax), x, other);
+        return _mm512_mask_max_epi32(result, keepMax, x, other);
+    }
+
+    __attribute__((target("avx512f"))) static void bitonicMerge(__m512i a, __m512i b, __m512i& low, __m512i& high)
+    {
+        const __m512i reverse = _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+        const __m512i distance8 = _mm512_setr_epi32(8, 9, 10, 11, 12, 13, 14, 15, 0, 1, 2, 3, 4, 5, 6, 7);
+        const __m512i distance4 = _mm512_setr_epi32(4, 5, 6, 7, 0, 1, 2, 3, 12, 13, 14, 15, 8, 9, 10, 11);
+        const __m512i distance2 = _mm512_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13);
+        const __m512i distance1 = _mm512_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+
+        b = _mm512_mask_permutexvar_epi32(b, 0xFFFF, reverse, b);
+        __m512i l = _mm512_mask_min_epi32(a, 0xFFFF, a, b);
+        __m512i h = _mm512_mask_max_epi32(a, 0xFFFF, a, b);
+
+        l = halfClean(l, distance8, 0xFF00);
+        h = halfClean(h, distance8, 0xFF00);
+        l = halfClean(l, distance4, 0xF0F0);
+        h = halfClean(h, distance4, 0xF0F0);
+        l = halfClean(l, distance2, 0xCCCC);
+        h = halfClean(h, distance2, 0xCCCC);
+        low = halfClean(l, distance1, 0xAAAA);
+        high = halfClean(h, distance1, 0xAAAA);
+    }
+
+    __attribute__((target("avx512f"))) static void mergeAvx512(const int* left, size_t leftSize, const int* right,
+                                                               size_t rightSize, int* out)
+    {
+        const int W = 16;
+        __m512i low;
+        __m512i high;
+        bitonicMerge(_mm512_loadu_si512(left), _mm512_loadu_si512(right), low, high);
+        _mm512_storeu_si512(out, low);
+        INSTRUMENT_COMPARISONS(networkComparisons(W));
+
+        size_t i = W;
+        size_t j = W;
+        size_t k = W;
+
+        while (i + W <= leftSize && j + W <= rightSize)
+        {
+            INSTRUMENT_COMPARISONS(1 + networkComparisons(W));
+            bool takeLeft = left[i] <= right[j];
+            const int* next = takeLeft ? left + i : right + j;
+            i += takeLeft ? W : 0;
+            j += takeLeft ? 0 : W;
+
+            bitonicMerge(_mm512_loadu_si512(next), high, low, high);
+            _mm512_storeu_si512(out + k, low);
+            k += W;
+        }
+
+        alignas(64) int rest[W];
+        _mm512_store_si512(rest, high);
+        finish(rest, W, left, i, leftSize, right, j, rightSize, out + k);
+    }
+#endif
+};
@@ -1,137 +1,25 @@
+#include <cassert>
 #include <iomanip>
 #include <iostream>
+#include <random>
 #include <vector>
 
-using namespace std;
-
-/*
-    Merge Sort Properties:
-    - Divide and Conquer algorithm that splits array into two halves, recursively sorts them, then merges
-    - Stable sort: preserves relative order of equal elements
-    - Properties:
-        * Not in-place: requires extra space proportional to input size
-        * External sorting: efficient for sorting large files that don't fit in memory
-        * Parallelizable: different parts can be sorted independently
-        * Predictable: always O(n log n) regardless of input order
-*/
-
-/*
-    MergeSorter::sort() - Merge Sort Visualization
-    Example with array [64, 34, 25, 12, 22, 11, 90]
-
-    Splitting Phase (Top-Down):
-    [64, 34, 25, 12, 22, 11, 90]                 // Initial array
-    /                          \
-    [64, 34, 25, 12]          [22, 11, 90]       // Split 1
-    /            \            /          \
-    [64, 34]    [25, 12]    [22, 11]    [90]     // Split 2
-    /     \      /    \      /    \       |
-    [64]  [34]  [25]  [12]  [22]  [11]   [90]    // Individual elements
-
-    Merging Phase (Bottom-Up):
-    [34, 64]  [12, 25]       [11, 22] [90]       // First merge: Compare & sort pairs
-       \         /              \      |
-    [12, 25, 34, 64]         [11, 22, 90]        // Second merge: Merge sorted halves
-              \                    /
-            [11, 12, 22, 25, 34, 64, 90]         // Final merge: Complete sorted array
-
-    Key Operations:
-    1. Splitting: O(log n) levels of recursion
-    2. Merging: O(n) comparisons at each level
-    3. Total: O(n log n) comparisons
+#include "MergeSorter.h"
 
-    Space Complexity Analysis:
-    - Temporary arrays: O(n) for merge operation
-    - Recursion stack: O(log n) for function calls
-    - Total: O(n) extra space
-
-    Advantages:
-    1. Stable sorting
-    2. Guaranteed O(n log n) performance
-    3. Good for linked lists (no random access needed)
-    4. Cache-friendly sequential access
-
-    Disadvantages:
-    1. Extra space requirement
-    2. Overkill for small arrays
-    3. Not adaptive (doesn't benefit from partially sorted input)
-*/
+using namespace std;
 
-class MergeSorter
+// Element that remembers its original position, to check stability
+struct StableItem
 {
-public:
-    static void sort(vector<int>& arr)
-    {
-        if (arr.empty()) return;
-
-        sort(arr, 0, arr.size() - 1);
-    }
-
-private:
-    static void sort(vector<int>& arr, int left, int right)
-    {
-        if (left >= right) return;
-
-        int mid = left + (right - left) / 2;
-
-        sort(arr, left, mid);
-        sort(arr, mid + 1, right);
-
-        merge(arr, left, mid, right);
-    }
-
-    static void merge(vector<int>& arr, int left, int mid, int right)
-    {
-        // Create temporary arrays
-        int leftSize = mid - left + 1;
-        int rightSize = right - mid;
-
-        vector<int> leftArr(leftSize);
-        vector<int> rightArr(rightSize);
-
-        for (int i = 0; i < leftSize; i++) leftArr[i] = arr[left + i];
-        for (int i = 0; i < rightSize; i++) rightArr[i] = arr[mid + 1 + i];
-
-        // Merge the temporary arrays back into arr[left..right]
-        int leftIdx = 0;
-        int rightIdx = 0;
-        int mergeIdx = left;
-
-        while (leftIdx < leftSize && rightIdx < rightSize)
-        {
-            if (leftArr[leftIdx] <= rightArr[rightIdx])
-            {
-                arr[mergeIdx] = leftArr[leftIdx];
-                leftIdx++;
-            }
-            else
-            {
-                arr[mergeIdx] = rightArr[rightIdx];
-                rightIdx++;
-            }
-
-            mergeIdx++;
-        }
-
-        // Copy remaining elements
-        while (leftIdx < leftSize)
-        {
-            arr[mergeIdx] = leftArr[leftIdx];
-
-            leftIdx++;
-            mergeIdx++;
-        }
-
-        while (rightIdx < rightSize)
-        {
-            arr[mergeIdx] = rightArr[rightIdx];
-
-            rightIdx++;
-            mergeIdx++;
-        }
-    }
+    int key;
+    int position;
 };
 
+bool operator<=(const StableItem& a, const StableItem& b)
+{
+    return a.key <= b.key;
+}
+
 void printArray(const vector<int>& arr, const string& label)
 {
     cout << label << ": ";
@@ -175,6 +63,33 @@ int main()
     printArray(arr4, "Before");
     MergeSorter::sort(arr4);
     printArray(arr4, "After ");
+    cout << endl;
+
+    // Example 5: In-place stable merge (sqrt(n) buffer, and no buffer at all)
+    vector<int> arr5 = {3, 1, 4, 1, 5, 9, 2, 6, 5, 3, 5, 8, 9, 7, 9, 3, 2, 3, 8, 4};
+    cout << "Example 5 - In-place merge sort (sqrt(n) buffer)\n";
+    cout << "-----------------------------------------------\n";
+    printArray(arr5, "Before");
+    MergeSorter::sortInPlace(arr5);
+    printArray(arr5, "After ");
+
+    // Stability check: sort (key, original position) pairs by key only
+    mt19937 rng(42);
+    vector<StableItem> items(100000);
+    for (int i = 0; i < static_cast<int>(items.size()); i++) items[i] = {static_cast<int>(rng() % 100), i};
+
+    for (size_t bufferSize : {size_t(0), size_t(1), size_t(5), size_t(317)})
+    {
+        vector<StableItem> sorted = items;
+        MergeSorter::sortInPlace(sorted, bufferSize);
+
+        for (size_t i = 1; i < sorted.size(); i++)
+        {
+            assert(sorted[i - 1].key <= sorted[i].key);
+            if (sorted[i - 1].key == sorted[i].key) assert(sorted[i - 1].position < sorted[i].position);
+        }
+    }
+    cout << "Assertion passed: in-place merge sort is stable for buffer sizes 0, 1, 5 and sqrt(n)!" << endl;
 
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,569 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "../../Instrumentation/Instrumentation.h"
+#include "../Sorter Context/SorterContext.h"
+#include "MergeKernels.h"
+
+using namespace std;
+
+/*
+    Merge Sort Properties:
+    - Divide and Conquer algorithm that splits array into two halves, recursively sorts them, then merges
+    - Stable sort: preserves relative order of equal elements
+    - Properties:
+        * Not in-place: requires extra space proportional to input size
+        * External sorting: efficient for sorting large files that don't fit in memory
+        * Parallelizable: different parts can be sorted independently
+        * Predictable: always O(n log n) regardless of input order
+*/
+
+/*
+    MergeSorter::sort() - Merge Sort Visualization
+    Example with array [64, 34, 25, 12, 22, 11, 90]
+
+    Splitting Phase (Top-Down):
+    [64, 34, 25, 12, 22, 11, 90]                 // Initial array
+    /                          \
+    [64, 34, 25, 12]          [22, 11, 90]       // Split 1
+    /            \            /          \
+    [64, 34]    [25, 12]    [22, 11]    [90]     // Split 2
+    /     \      /    \      /    \       |
+    [64]  [34]  [25]  [12]  [22]  [11]   [90]    // Individual elements
+
+    Merging Phase (Bottom-Up):
+    [34, 64]  [12, 25]       [11, 22] [90]       // First merge: Compare & sort pairs
+       \         /              \      |
+    [12, 25, 34, 64]         [11, 22, 90]        // Second merge: Merge sorted halves
+              \                    /
+            [11, 12, 22, 25, 34, 64, 90]         // Final merge: Complete sorted array
+
+    Key Operations:
+    1. Splitting: O(log n) levels of recursion
+    2. Merging: O(n) comparisons at each level
+    3. Total: O(n log n) comparisons
+
+    Space Complexity Analysis:
+    - Temporary arrays: O(n) for merge operation
+    - Recursion stack: O(log n) for function calls
+    - Total: O(n) extra space
+
+    Advantages:
+    1. Stable sorting
+    2. Guaranteed O(n log n) performance
+    3. Good for linked lists (no random access needed)
+    4. Cache-friendly sequential access
+
+    Disadvantages:
+    1. Extra space requirement
+    2. Overkill for small arrays
+    3. Not adaptive (doesn't benefit from partially sorted input)
+*/
+
+class MergeSorter
+{
+    // LogStructuredSortedSet compacts its sorted levels with merge()
+    friend class LogStructuredSortedSet;
+
+public:
+    // Works for any element type with `<=` (e.g. int, or the KeyIndex pairs used by IndirectSorter)
+    template <typename T>
+    static void sort(vector<T>& arr)
+    {
+        if (arr.empty()) return;
+
+        sort(arr, 0, arr.size() - 1);
+    }
+
+    /*
+        Allocation-free variant: every merge borrows its leftArr/rightArr from the context's arena.
+        The two temporaries of one merge never exceed n elements together, and merges run one at a time,
+        so a single n-element scratch region serves the whole sort.
+    */
+    template <typename T>
+    static void sort(vector<T>& arr, SorterContext& context)
+    {
+        if (arr.empty()) return;
+
+        context.reset();
+        T* scratch = context.allocate<T>(arr.size());
+
+        sort(arr, 0, arr.size() - 1, scratch);
+    }
+
+    /*
+        In-Place Stable Merge Sort (bounded buffer):
+        - Problem: sort() needs O(n) extra memory for leftArr/rightArr - a 4 GB array needs another 4 GB
+        - Solution: a fixed buffer of `bufferSize` elements (default sqrt(n): 32K ints = 128 KB for a 4 GB array)
+
+        Adaptive merge of runs A = arr[first..middle-1] and B = arr[middle..last-1]:
+        1. If A fits in the buffer: copy A out, merge forwards (same loop as merge())
+        2. Else if B fits in the buffer: copy B out, merge backwards from the end
+        3. Else if the runs split into at most bufferSize blocks of bufferSize elements: block merge
+           (blockMerge() below) - order the blocks by first element, swap them into place through the buffer,
+           then merge neighbouring blocks through the buffer; every element moves O(1) times
+        4. Else (buffer too small, e.g. 0) split both runs by rank and swap the middle pieces with a rotation:
+
+             A = [ A1 | A2 ]   B = [ B1 | B2 ]     cut A at its midpoint value x, cut B where x would be inserted
+             rotate A2 and B1:  [ A1 | B1 | A2 | B2 ]
+             now everything in A1,B1 <= everything in A2,B2 -> merge (A1,B1) and (A2,B2) independently
+
+           Stability: B is cut at the LOWER bound of x (B's copies of x stay after A's x),
+                      A is cut at the UPPER bound when cutting by a B value (A's copies stay before)
+
+        Cost:
+        - bufferSize >= sqrt(n) (the default): every merge is linear, so O(n log n) like sort(), with a few
+          more element moves per merge (block swaps, head and tail passes)
+        - Smaller buffers: rotations until the pieces are small enough for step 3
+        - bufferSize = 0 gives a strict O(1)-memory sort (all merges by rotation): O(n log^2 n)
+
+        Space Complexity: O(bufferSize) elements + bufferSize block indices + O(log n) recursion
+    */
+    template <typename T>
+    static void sortInPlace(vector<T>& arr, size_t bufferSize)
+    {
+        if (arr.size() < 2) return;
+
+        vector<T> buffer(bufferSize);
+        vector<size_t> blockOrder(bufferSize);
+        sortInPlace(arr, 0, arr.size(), buffer, blockOrder);
+    }
+
+    template <typename T>
+    static void sortInPlace(vector<T>& arr)
+    {
+        sortInPlace(arr, static_cast<size_t>(ceil(sqrt(static_cast<double>(arr.size())))));
+    }
+
+    /*
+        Compile-time variant for fixed tables (std::array, C++17 constexpr):
+        - Bottom-up instead of recursive: merge runs of width 1, 2, 4, ... into a second array, copy back
+        - Same stable `<=` merge rule as merge(); the temporaries are one array<T, N> instead of vectors
+        - Needs T to be default-constructible and usable in constant expressions (ints, enums, literal structs)
+    */
+    template <typename T, size_t N>
+    static constexpr void sort(array<T, N>& arr)
+    {
+        array<T, N> buffer{};
+
+        for (size_t width = 1; width < N; width *= 2)
+        {
+            for (size_t left = 0; left < N; left += 2 * width)
+            {
+                size_t mid = min(left + width, N);
+                size_t right = min(left + 2 * width, N);
+
+                size_t leftIdx = left;
+                size_t rightIdx = mid;
+                size_t mergeIdx = left;
+
+                while (leftIdx < mid && rightIdx < right)
+                {
+                    if (arr[leftIdx] <= arr[rightIdx]) buffer[mergeIdx++] = arr[leftIdx++];
+                    else buffer[mergeIdx++] = arr[rightIdx++];
+                }
+
+                while (leftIdx < mid) buffer[mergeIdx++] = arr[leftIdx++];
+                while (rightIdx < right) buffer[mergeIdx++] = arr[rightIdx++];
+            }
+
+            arr = buffer;
+        }
+    }
+
+    template <typename T, size_t N>
+    static constexpr array<T, N> sorted(array<T, N> arr)
+    {
+        sort(arr);
+        return arr;
+    }
+
+private:
+    static const size_t IN_PLACE_INSERTION_SORT_SIZE = 16;
+
+    // Half-open range [first, last)
+    template <typename T>
+    static void sortInPlace(vector<T>& arr, size_t first, size_t last, vector<T>& buffer, vector<size_t>& blockOrder)
+    {
+        if (last - first <= IN_PLACE_INSERTION_SORT_SIZE)
+        {
+            insertionSort(arr, first, last);
+            return;
+        }
+
+        INSTRUMENT_RECURSION_SCOPE();
+
+        size_t middle = first + (last - first) / 2;
+
+        sortInPlace(arr, first, middle, buffer, blockOrder);
+        sortInPlace(arr, middle, last, buffer, blockOrder);
+
+        // Runs already in order - nothing to merge
+        if (arr[middle - 1] <= arr[middle]) return;
+
+        mergeInPlace(arr, first, middle, last, buffer, blockOrder);
+    }
+
+    template <typename T>
+    static void mergeInPlace(vector<T>& arr, size_t first, size_t middle, size_t last, vector<T>& buffer,
+                             vector<size_t>& blockOrder)
+    {
+        size_t leftSize = middle - first;
+        size_t rightSize = last - middle;
+
+        if (leftSize == 0 || rightSize == 0) return;
+
+        size_t bufferSize = buffer.size();
+
+        if (leftSize <= rightSize && leftSize <= bufferSize)
+        {
+            mergeForward(arr, first, middle, last, buffer);
+            return;
+        }
+
+        if (rightSize <= bufferSize)
+        {
+            mergeBackward(arr, first, middle, last, buffer);
+            return;
+        }
+
+        // Enough buffer for at most bufferSize blocks of bufferSize elements: linear block merge
+        if (bufferSize > 0 && (leftSize + rightSize) / bufferSize <= bufferSize)
+        {
+            blockMergeRuns(arr, first, middle, last, buffer, blockOrder);
+            return;
+        }
+
+        if (leftSize + rightSize == 2)
+        {
+            // One element each and no buffer: a single compare-and-swap
+            if (!(arr[first] <= arr[middle])) swap(arr[first], arr[middle]);
+            return;
+        }
+
+        size_t leftCut;
+        size_t rightCut;
+
+        if (leftSize > rightSize)
+        {
+            leftCut = first + leftSize / 2;
+            rightCut = lowerBound(arr, middle, last, arr[leftCut]);
+        }
+        else
+        {
+            rightCut = middle + rightSize / 2;
+            leftCut = upperBound(arr, first, middle, arr[rightCut]);
+        }
+
+        rotate(arr, leftCut, middle, rightCut);
+        size_t newMiddle = leftCut + (rightCut - middle);
+
+        mergeInPlace(arr, first, leftCut, newMiddle, buffer, blockOrder);
+        mergeInPlace(arr, newMiddle, rightCut, last, buffer, blockOrder);
+    }
+
+    /*
+        Runs longer than the buffer, split into blocks of bufferSize elements:
+            [ head | A blocks ... ][ B blocks ... | tail ]      head, tail: the < bufferSize leftovers
+        The block-aligned middle goes through blockMerge(); the tail (B's largest elements) is then merged in
+        backwards and the head (A's smallest) forwards, both through the buffer since each is shorter than it.
+    */
+    template <typename T>
+    static void blockMergeRuns(vector<T>& arr, size_t first, size_t middle, size_t last, vector<T>& buffer,
+                               vector<size_t>& blockOrder)
+    {
+        size_t blockSize = buffer.size();
+        size_t blocksFirst = first + (middle - first) % blockSize;
+        size_t blocksLast = last - (last - middle) % blockSize;
+
+        if (blocksFirst < middle && middle < blocksLast && !(arr[middle - 1] <= arr[middle]))
+        {
+            blockMerge(arr, blocksFirst, middle, blocksLast, buffer, blockOrder);
+        }
+
+        if (blocksLast < last) mergeBackward(arr, blocksFirst, blocksLast, last, buffer);
+        if (first < blocksFirst) mergeForward(arr, first, blocksFirst, last, buffer);
+    }
+
+    /*
+        Block merge (the WikiSort / GrailSort scheme, with the block buffer outside the array):
+        1. Order the blocks by their first element (ties: A block first). A's blocks and B's blocks are each
+           already in that order, so the order is a merge of the two key lists - no block sort needed
+        2. Put the blocks in that order by following the permutation's cycles, one block parked in the buffer:
+           every element moves once (plus once through the buffer per cycle)
+        3. Walk the blocks left to right with a "fragment": the not-yet-final tail of the last block.
+           Same-origin block next: the fragment is final. Other origin: merge fragment and block through the
+           buffer until one runs out; what is left of the other becomes the new fragment
+
+             A = [1 4 6 | 7 8 9]   B = [2 3 5 | 10 11 12]      blocks of 3
+             order by first:  [1 4 6] [2 3 5] [7 8 9] [10 11 12]
+             [1 4 6]+[2 3 5]  -> 1 2 3 4 5, B block used up, fragment [6] (A)
+             [7 8 9] is from A too -> 6 is final, fragment [7 8 9]
+             [7 8 9]+[10 11 12] -> 7 8 9, fragment used up, fragment [10 11 12] (B) is final at the end
+
+        Every element is compared and moved O(1) times: O(n) per merge, so O(n log n) for the sort.
+        blockOrder holds one index per block (at most bufferSize of them); its top bit marks placed blocks.
+    */
+    template <typename T>
+    static void blockMerge(vector<T>& arr, size_t first, size_t middle, size_t last, vector<T>& buffer,
+                           vector<size_t>& blockOrder)
+    {
+        const size_t PLACED = ~(~size_t(0) >> 1);
+        size_t blockSize = buffer.size();
+        size_t leftBlocks = (middle - first) / blockSize;
+        size_t blocks = (last - first) / blockSize;
+
+        // 1. Target order: slot d receives block blockOrder[d]
+        size_t nextLeft = 0;
+        size_t nextRight = leftBlocks;
+        for (size_t d = 0; d < blocks; d++)
+        {
+            bool takeLeft = nextLeft < leftBlocks &&
+                            (nextRight == blocks || arr[first + nextLeft * blockSize] <= arr[first + nextRight * blockSize]);
+            blockOrder[d] = takeLeft ? nextLeft++ : nextRight++;
+        }
+
+        // 2. Apply it cycle by cycle
+        for (size_t start = 0; start < blocks; start++)
+        {
+            if (blockOrder[start] & PLACED) continue;
+
+            copyBlock(arr.data() + first + start * blockSize, buffer.data(), blockSize);
+            size_t slot = start;
+            while (true)
+            {
+                size_t source = blockOrder[slot];
+                blockOrder[slot] |= PLACED;
+
+                if (source == start)
+                {
+                    copyBlock(buffer.data(), arr.data() + first + slot * blockSize, blockSize);
+                    break;
+                }
+                copyBlock(arr.data() + first + source * blockSize, arr.data() + first + slot * blockSize, blockSize);
+                slot = source;
+            }
+        }
+
+        // 3. Local merges: fragment = arr[fragmentFirst .. blockFirst-1], always shorter than the buffer
+        size_t fragmentFirst = first;
+        bool fragmentFromLeft = (blockOrder[0] & ~PLACED) < leftBlocks;
+
+        for (size_t d = 1; d < blocks; d++)
+        {
+            size_t blockFirst = first + d * blockSize;
+            size_t blockLast = blockFirst + blockSize;
+            bool blockFromLeft = (blockOrder[d] & ~PLACED) < leftBlocks;
+
+            if (blockFromLeft == fragmentFromLeft)
+            {
+                fragmentFirst = blockFirst;
+                continue;
+            }
+
+            size_t fragmentSize = blockFirst - fragmentFirst;
+            copyBlock(arr.data() + fragmentFirst, buffer.data(), fragmentSize);
+
+            size_t fragmentIdx = 0;
+            size_t blockIdx = blockFirst;
+            size_t mergeIdx = fragmentFirst;
+
+            while (fragmentIdx < fragmentSize && blockIdx < blockLast)
+            {
+                // Ties go to whichever side came from A
+                bool takeFragment = fragmentFromLeft ? buffer[fragmentIdx] <= arr[blockIdx]
+                                                     : !(arr[blockIdx] <= buffer[fragmentIdx]);
+
+                if (takeFragment) arr[mergeIdx++] = buffer[fragmentIdx++];
+                else arr[mergeIdx++] = arr[blockIdx++];
+            }
+
+            if (fragmentIdx == fragmentSize)
+            {
+                // Fragment used up: the rest of the block is the new fragment
+                fragmentFirst = blockIdx;
+                fragmentFromLeft = blockFromLeft;
+            }
+            else
+            {
+                // Block used up: the rest of the fragment goes back in front of the next block
+                copyBlock(buffer.data() + fragmentIdx, arr.data() + mergeIdx, fragmentSize - fragmentIdx);
+                fragmentFirst = mergeIdx;
+            }
+        }
+    }
+
+    template <typename T>
+    static void copyBlock(const T* from, T* to, size_t count)
+    {
+        for (size_t i = 0; i < count; i++) to[i] = from[i];
+    }
+
+    // Left run fits in the buffer: copy it out, merge into arr from the front
+    template <typename T>
+    static void mergeForward(vector<T>& arr, size_t first, size_t middle, size_t last, vector<T>& buffer)
+    {
+        size_t leftSize = middle - first;
+        copyBlock(arr.data() + first, buffer.data(), leftSize);
+
+        size_t leftIdx = 0;
+        size_t rightIdx = middle;
+        size_t mergeIdx = first;
+
+        while (leftIdx < leftSize && rightIdx < last)
+        {
+            if (buffer[leftIdx] <= arr[rightIdx]) arr[mergeIdx++] = buffer[leftIdx++];
+            else arr[mergeIdx++] = arr[rightIdx++];
+        }
+
+        while (leftIdx < leftSize) arr[mergeIdx++] = buffer[leftIdx++];
+    }
+
+    // Right run fits in the buffer: copy it out, merge into arr from the back (indices point one past)
+    template <typename T>
+    static void mergeBackward(vector<T>& arr, size_t first, size_t middle, size_t last, vector<T>& buffer)
+    {
+        size_t rightSize = last - middle;
+        copyBlock(arr.data() + middle, buffer.data(), rightSize);
+
+        size_t leftIdx = middle;
+        size_t rightIdx = rightSize;
+        size_t mergeIdx = last;
+
+        while (leftIdx > first && rightIdx > 0)
+        {
+            // Ties take the right element first when walking backwards, which keeps left-before-right order
+            if (arr[leftIdx - 1] <= buffer[rightIdx - 1]) arr[--mergeIdx] = buffer[--rightIdx];
+            else arr[--mergeIdx] = arr[--leftIdx];
+        }
+
+        while (rightIdx > 0) arr[--mergeIdx] = buffer[--rightIdx];
+    }
+
+    // Swaps the adjacent blocks arr[first..middle-1] and arr[middle..last-1] with three reversals
+    template <typename T>
+    static void rotate(vector<T>& arr, size_t first, size_t middle, size_t last)
+    {
+        reverse(arr, first, middle);
+        reverse(arr, middle, last);
+        reverse(arr, first, last);
+    }
+
+    template <typename T>
+    static void reverse(vector<T>& arr, size_t first, size_t last)
+    {
+        while (first + 1 < last) swap(arr[first++], arr[--last]);
+    }
+
+    // First index in [first, last) whose element is >= value
+    template <typename T>
+    static size_t lowerBound(const vector<T>& arr, size_t first, size_t last, const T& value)
+    {
+        while (first < last)
+        {
+            size_t mid = first + (last - first) / 2;
+
+            if (value <= arr[mid]) last = mid;
+            else first = mid + 1;
+        }
+        return first;
+    }
+
+    // First index in [first, last) whose element is > value
+    template <typename T>
+    static size_t upperBound(const vector<T>& arr, size_t first, size_t last, const T& value)
+    {
+        while (first < last)
+        {
+            size_t mid = first + (last - first) / 2;
+
+            if (arr[mid] <= value) first = mid + 1;
+            else last = mid;
+        }
+        return first;
+    }
+
+    template <typename T>
+    static void insertionSort(vector<T>& arr, size_t first, size_t last)
+    {
+        for (size_t i = first + 1; i < last; i++)
+        {
+            T value = arr[i];
+            size_t j = i;
+
+            while (j > first && !(arr[j - 1] <= value))
+            {
+                arr[j] = arr[j - 1];
+                j--;
+            }
+
+            arr[j] = value;
+        }
+    }
+
+    template <typename T>
+    static void sort(vector<T>& arr, int left, int right)
+    {
+        if (left >= right) return;
+
+        INSTRUMENT_RECURSION_SCOPE();
+
+        int mid = left + (right - left) / 2;
+
+        sort(arr, left, mid);
+        sort(arr, mid + 1, right);
+
+        merge(arr, left, mid, right);
+    }
+
+    template <typename T>
+    static void sort(vector<T>& arr, int left, int right, T* scratch)
+    {
+        if (left >= right) return;
+
+        INSTRUMENT_RECURSION_SCOPE();
+
+        int mid = left + (right - left) / 2;
+
+        sort(arr, left, mid, scratch);
+        sort(arr, mid + 1, right, scratch);
+
+        merge(arr, left, mid, right, scratch, scratch + (mid - left + 1));
+    }
+
+    template <typename T>
+    static void merge(vector<T>& arr, int left, int mid, int right)
+    {
+        // Create temporary arrays
+        vector<T> leftArr(mid - left + 1);
+        vector<T> rightArr(right - mid);
+
+        merge(arr, left, mid, right, leftArr.data(), rightArr.data());
+    }
+
+    // Merges arr[left..mid] and arr[mid+1..right] using caller-provided temporaries
+    template <typename T>
+    static void merge(vector<T>& arr, int left, int mid, int right, T* leftArr, T* rightArr)
+    {
+        int leftSize = mid - left + 1;
+        int rightSize = right - mid;
+
+        for (int i = 0; i < leftSize; i++) leftArr[i] = arr[left + i];
+        for (int i = 0; i < rightSize; i++) rightArr[i] = arr[mid + 1 + i];
+        INSTRUMENT_MOVES(leftSize + rightSize);
+
+        // Every element is copied back exactly once
+        INSTRUMENT_MOVES(leftSize + rightSize);
+
+        // Merge the temporary arrays back into arr[left..right]: bitonic SIMD kernel for int, branchless otherwise.
+        // The kernels count their own comparisons, so the profiler measures the code that really runs.
+        MergeKernels::merge(leftArr, static_cast<size_t>(leftSize), rightArr, static_cast<size_t>(rightSize),
+                            arr.data() + left);
+    }
+};
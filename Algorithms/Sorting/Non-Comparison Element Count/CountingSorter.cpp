@@ -1,59 +1,16 @@
+#include <algorithm>
+#include <cassert>
+#include <cmath>
 #include <iomanip>
 #include <iostream>
 #include <map>
+#include <random>
+#include <stdexcept>
 #include <vector>
 
-using namespace std;
-
-/*
-    Counting Sort Algorithm:
-    1. Count frequencies using hash map (handles negative & positive integers)
-    2. Calculate cumulative frequencies to determine positions
-    3. Build output array by placing elements in their sorted positions
-
-    Time Complexity: O(n + k) where k is number of unique elements
-    Space Complexity: O(k) where k is number of unique elements
-
-    Features:
-    - Handles negative and positive integers
-    - Maintains stability (preserves order of equal elements)
-    - Works with duplicates
-    - Memory efficient (only stores unique elements)
-*/
-
-class CountingSorter
-{
-public:
-    static vector<int> sort(vector<int>& arr)
-    {
-        if (arr.empty()) return arr;
-
-        map<int, int> frequency;
-
-        for (int num : arr) frequency[num]++;
-
-        vector<int> output(arr.size());
-
-        size_t sum = 0;
-
-        for (auto& pair : frequency)
-        {
-            int count = pair.second;
-            pair.second = sum;
-            sum += count;
-        }
-
-        for (size_t i = arr.size() - 1; i >= 0; i--)
-        {
-            int currentNum = arr[i];
-            int position = frequency[currentNum];
-            output[position] = currentNum;
-            frequency[currentNum]++;
-        }
+#include "CountingSorter.h"
 
-        return output;
-    }
-};
+using namespace std;
 
 void printArray(const vector<int>& arr)
 {
@@ -90,5 +47,118 @@ int main()
         printArray(sorted);
     }
 
+    cout << "\n\033[1;36mRun-Length Histogram\033[0m" << endl;
+    cout << "\033[1;36m--------------------\033[0m" << endl;
+
+    vector<int> readings = {4, 4, 2, 2, 2, 8, 3, 3, 1, -1};
+    RunLengthHistogram histogram = CountingSorter::histogram(readings);
+
+    cout << "(value, count): ";
+    for (const ValueCount& run : histogram.valueCounts()) cout << "(" << run.value << ", " << run.count << ") ";
+    cout << endl;
+    cout << "median: " << histogram.percentile(50) << ", p90: " << histogram.percentile(90) << endl;
+
+    assert(histogram.distinct() == 6 && histogram.size() == readings.size());
+    assert(histogram.expand() == CountingSorter::sort(readings));
+    assert(histogram.percentile(50) == 2 && histogram.percentile(90) == 4 && histogram.percentile(100) == 8);
+
+    // Lazy expansion matches the sorted array element by element
+    vector<int> expected = CountingSorter::sort(readings);
+    size_t position = 0;
+    for (int value : histogram) assert(value == expected[position++]);
+    assert(position == expected.size());
+
+    // Histograms of two shards merge into the histogram of the whole (dense and sparse key paths)
+    mt19937 rng(42);
+    uniform_int_distribution<int> dense(-50, 50);
+    uniform_int_distribution<int> sparse(-1000000000, 1000000000);
+
+    for (int round = 0; round < 2; round++)
+    {
+        vector<int> left(20000);
+        vector<int> right(15000);
+        for (int& num : left) num = round == 0 ? dense(rng) : sparse(rng) % 3000 * 100000;
+        for (int& num : right) num = round == 0 ? dense(rng) : sparse(rng) % 3000 * 100000;
+
+        vector<int> both = left;
+        both.insert(both.end(), right.begin(), right.end());
+
+        RunLengthHistogram merged =
+            RunLengthHistogram::merge(CountingSorter::histogram(left), CountingSorter::histogram(right));
+        vector<int> sortedBoth = CountingSorter::sort(both);
+
+        assert(merged.expand() == sortedBoth);
+        for (size_t rank = 0; rank < sortedBoth.size(); rank += 997) assert(merged.valueAt(rank) == sortedBoth[rank]);
+
+        cout << (round == 0 ? "dense" : "sparse") << " keys: " << both.size() << " elements -> " << merged.distinct()
+             << " runs" << endl;
+    }
+
+    // Range wider than DENSE_HISTOGRAM_RANGE but below n: few distinct values are hashed, not counted densely
+    vector<int> wide(200000);
+    for (size_t i = 0; i < wide.size(); i++) wide[i] = static_cast<int>(rng() % 3000) * 60;
+    RunLengthHistogram wideHistogram = CountingSorter::histogram(wide);
+    assert(wideHistogram.expand() == CountingSorter::sort(wide));
+    assert(wideHistogram.distinct() <= 3000);
+
+    // Empty histogram: rank and percentile queries throw instead of reading past the runs
+    RunLengthHistogram empty = CountingSorter::histogram(vector<int>());
+    bool threw = false;
+    try
+    {
+        empty.percentile(50);
+    }
+    catch (const out_of_range&)
+    {
+        threw = true;
+    }
+    assert(threw && empty.size() == 0);
+
+    // NaN percentiles and out-of-order runs are rejected; huge percentiles clamp to the extremes
+    int rejected = 0;
+    try
+    {
+        histogram.percentile(nan(""));
+    }
+    catch (const invalid_argument&)
+    {
+        rejected++;
+    }
+    try
+    {
+        RunLengthHistogram unsorted({{3, 1}, {1, 2}});
+    }
+    catch (const invalid_argument&)
+    {
+        rejected++;
+    }
+    try
+    {
+        RunLengthHistogram repeated({{1, 1}, {1, 2}});
+    }
+    catch (const invalid_argument&)
+    {
+        rejected++;
+    }
+    assert(rejected == 3);
+    assert(histogram.percentile(-1e300) == -1 && histogram.percentile(1e300) == 8);
+
+    // Dense keys through the context path: once the arena is warm, sorting again allocates nothing
+    vector<int> denseKeys(150000);
+    for (int& num : denseKeys) num = static_cast<int>(rng() % 200000) - 100000;
+    vector<int> expectedDense = denseKeys;
+    std::sort(expectedDense.begin(), expectedDense.end());
+
+    SorterContext context;
+    vector<int> denseCopy = denseKeys;
+    CountingSorter::sort(denseCopy, context);
+    assert(denseCopy == expectedDense);
+
+    size_t warmAllocations = context.heapAllocations();
+    CountingSorter::sort(denseKeys, context);
+    assert(denseKeys == expectedDense && context.heapAllocations() == warmAllocations);
+
+    cout << "\nAssertion passed: histograms match the expanded counting sort!" << endl;
+
     return 0;
 }
\ No newline at end of file
@@ -0,0 +1,286 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <map>
+#include <unordered_map>
+#include <vector>
+
+#include "../../Prefix Sum/PrefixScanner.h"
+#include "../Merge Sort/MergeSorter.h"
+#include "../Sorter Context/SorterContext.h"
+#include "RunLengthHistogram.h"
+
+using namespace std;
+
+/*
+    Counting Sort Algorithm:
+    1. Count frequencies using hash map (handles negative & positive integers)
+    2. Calculate cumulative frequencies to determine positions
+    3. Build output array by placing elements in their sorted positions
+
+    Time Complexity: O(n + k) where k is number of unique elements
+    Space Complexity: O(k) where k is number of unique elements
+
+    Features:
+    - Handles negative and positive integers
+    - Maintains stability (preserves order of equal elements)
+    - Works with duplicates
+    - Memory efficient (only stores unique elements)
+*/
+
+class CountingSorter
+{
+public:
+    // histogram(): largest value range that gets a dense count array (65536 size_t counters = 512 KB)
+    static constexpr int64_t DENSE_HISTOGRAM_RANGE = 1 << 16;
+
+    // sort(arr, context) switch points; TuningProfile::apply() may replace them
+    static constexpr size_t COMPARISON_SORT_MAX_SIZE = 64;
+    static constexpr size_t COUNTING_RANGE_FACTOR = 2;
+    static inline size_t comparisonSortMaxSize = COMPARISON_SORT_MAX_SIZE;
+    static inline size_t countingRangeFactor = COUNTING_RANGE_FACTOR;
+
+    static vector<int> sort(vector<int>& arr)
+    {
+        if (arr.empty()) return arr;
+
+        map<int, size_t> frequency;
+
+        for (int num : arr) frequency[num]++;
+
+        vector<int> output(arr.size());
+
+        size_t sum = 0;
+
+        for (auto& pair : frequency)
+        {
+            size_t count = pair.second;
+            pair.second = sum;
+            sum += count;
+        }
+
+        // Walk forwards: each value's slot starts at its cumulative offset and moves right,
+        // so equal elements keep their original order (a reverse walk with size_t never terminates)
+        for (size_t i = 0; i < arr.size(); i++)
+        {
+            int currentNum = arr[i];
+            size_t position = frequency[currentNum];
+            output[position] = currentNum;
+            frequency[currentNum]++;
+        }
+
+        return output;
+    }
+
+    /*
+        Allocation-free in-place variant (scratch memory comes from the context's arena):
+        - Tiny inputs (n <= comparisonSortMaxSize): MergeSorter - 4 radix passes over 256 buckets cost more than
+          n log n comparisons
+        - Dense keys (value range <= max(countingRangeFactor * n, 1024)): classic counting sort with a count array
+          indexed by value - min
+        - Sparse keys: LSD radix sort, i.e. counting sort applied to one byte at a time (4 passes of 256 buckets)
+        - Both replace the map: no per-value node allocations, no output vector
+        - Both thresholds default to 64 and 2; a program can apply the Calibrator's measurements via TuningProfile
+    */
+    static void sort(vector<int>& arr, SorterContext& context)
+    {
+        if (arr.size() < 2) return;
+
+        if (arr.size() <= comparisonSortMaxSize)
+        {
+            MergeSorter::sort(arr, context);
+            return;
+        }
+
+        context.reset();
+
+        auto bounds = minmax_element(arr.begin(), arr.end());
+        int64_t low = *bounds.first;
+        int64_t range = static_cast<int64_t>(*bounds.second) - low + 1;
+        int64_t denseLimit = static_cast<int64_t>(countingRangeFactor) * static_cast<int64_t>(arr.size());
+
+        if (range <= max<int64_t>(denseLimit, 1024))
+        {
+            countingSortDense(arr, static_cast<int>(low), static_cast<size_t>(range), context);
+        }
+        else
+        {
+            radixSort(arr, context);
+        }
+    }
+
+    /*
+        Counting Argsort:
+        - Same three steps as sort(), but step 3 writes the ORIGINAL INDEX into each sorted slot instead of the value
+        - order[p] = index of the element that belongs at sorted position p
+        - Stable: equal keys keep their original relative order, so the permutation is unique
+    */
+    static vector<int> argsort(const vector<int>& keys)
+    {
+        map<int, size_t> frequency;
+
+        for (int key : keys) frequency[key]++;
+
+        size_t sum = 0;
+
+        for (auto& pair : frequency)
+        {
+            size_t count = pair.second;
+            pair.second = sum;
+            sum += count;
+        }
+
+        vector<int> order(keys.size());
+
+        for (size_t i = 0; i < keys.size(); i++)
+        {
+            order[frequency[keys[i]]++] = static_cast<int>(i);
+        }
+
+        return order;
+    }
+
+    /*
+        Radix Argsort (allocation-free apart from the returned order):
+        - The LSD radix sort below, carrying each key's original index along with it
+        - Every byte pass is stable, so equal keys keep their original relative order: same permutation as argsort()
+        - O(n) for any key distribution - no map nodes, no dependence on the number of distinct keys
+    */
+    static vector<int> argsort(const vector<int>& keys, SorterContext& context)
+    {
+        size_t n = keys.size();
+        vector<int> order(n);
+        for (size_t i = 0; i < n; i++) order[i] = static_cast<int>(i);
+        if (n < 2) return order;
+
+        context.reset();
+        uint32_t* sortKeys = context.allocate<uint32_t>(n);
+        uint32_t* keyBuffer = context.allocate<uint32_t>(n);
+        int* indices = order.data();
+        int* indexBuffer = context.allocate<int>(n);
+        size_t* offsets = context.allocate<size_t>(256);
+
+        for (size_t i = 0; i < n; i++) sortKeys[i] = static_cast<uint32_t>(keys[i]) ^ 0x80000000u;
+
+        for (int shift = 0; shift < 32; shift += 8)
+        {
+            memset(offsets, 0, 256 * sizeof(size_t));
+            for (size_t i = 0; i < n; i++) offsets[(sortKeys[i] >> shift) & 0xFF]++;
+
+            if (offsets[(sortKeys[0] >> shift) & 0xFF] == n) continue;
+
+            PrefixScanner::exclusiveScan(offsets, offsets, 256);
+
+            for (size_t i = 0; i < n; i++)
+            {
+                size_t position = offsets[(sortKeys[i] >> shift) & 0xFF]++;
+                keyBuffer[position] = sortKeys[i];
+                indexBuffer[position] = indices[i];
+            }
+
+            swap(sortKeys, keyBuffer);
+            swap(indices, indexBuffer);
+        }
+
+        // An odd number of scatter passes leaves the result in the scratch buffer
+        if (indices != order.data()) memcpy(order.data(), indices, n * sizeof(int));
+
+        return order;
+    }
+
+    /*
+        Run-length output mode:
+        - Steps 1-2 of counting sort only: the sorted (value, count) table is returned instead of being expanded
+        - Dense keys (value range <= min(max(n, 1024), DENSE_HISTOGRAM_RANGE)): count array indexed by value - min,
+          one pass, at most 512 KB of counters however many rows there are
+        - Sparse keys: hash the distinct values, then sort only those - memory is O(distinct values), not O(range)
+          (1e9 rows with a few thousand distinct values spread over the whole int domain need a few KB of counts)
+    */
+    static RunLengthHistogram histogram(const vector<int>& arr)
+    {
+        if (arr.empty()) return RunLengthHistogram();
+
+        auto bounds = minmax_element(arr.begin(), arr.end());
+        int64_t low = *bounds.first;
+        int64_t range = static_cast<int64_t>(*bounds.second) - low + 1;
+
+        vector<ValueCount> runs;
+
+        if (range <= min<int64_t>(max<int64_t>(static_cast<int64_t>(arr.size()), 1024), DENSE_HISTOGRAM_RANGE))
+        {
+            vector<size_t> count(static_cast<size_t>(range), 0);
+            for (int num : arr) count[num - low]++;
+
+            for (size_t v = 0; v < count.size(); v++)
+            {
+                if (count[v] > 0) runs.push_back({static_cast<int>(low + static_cast<int64_t>(v)), count[v]});
+            }
+        }
+        else
+        {
+            unordered_map<int, size_t> frequency;
+            for (int num : arr) frequency[num]++;
+
+            runs.reserve(frequency.size());
+            for (const auto& pair : frequency) runs.push_back({pair.first, pair.second});
+            std::sort(runs.begin(), runs.end(), [](const ValueCount& x, const ValueCount& y) { return x.value < y.value; });
+        }
+
+        return RunLengthHistogram(runs);
+    }
+
+private:
+    static void countingSortDense(vector<int>& arr, int low, size_t range, SorterContext& context)
+    {
+        size_t* count = context.allocate<size_t>(range);
+        memset(count, 0, range * sizeof(size_t));
+
+        for (int num : arr) count[num - low]++;
+
+        // Cumulative frequencies: count[v] becomes the first sorted position of value low + v
+        // (serial scan: the parallel one starts threads, and this path must not touch the heap)
+        size_t total = PrefixScanner::exclusiveScan(count, count, range);
+
+        // Values are plain ints, so filling each value's slot range is equivalent to the stable scatter
+        for (size_t v = 0; v < range; v++)
+        {
+            size_t end = v + 1 < range ? count[v + 1] : total;
+            fill(arr.begin() + count[v], arr.begin() + end, static_cast<int>(low + static_cast<int64_t>(v)));
+        }
+    }
+
+    /*
+        LSD Radix Sort (base 256):
+        - Flip the sign bit so negative numbers order before positive ones as unsigned keys
+        - For each byte, least significant first: count, prefix-sum into bucket offsets (PrefixScanner), scatter (stable)
+        - Stability of each pass is what makes the final order correct
+        - A pass where every key has the same byte is skipped
+    */
+    static void radixSort(vector<int>& arr, SorterContext& context)
+    {
+        size_t n = arr.size();
+        uint32_t* keys = context.allocate<uint32_t>(n);
+        uint32_t* buffer = context.allocate<uint32_t>(n);
+        size_t* offsets = context.allocate<size_t>(256);
+
+        for (size_t i = 0; i < n; i++) keys[i] = static_cast<uint32_t>(arr[i]) ^ 0x80000000u;
+
+        for (int shift = 0; shift < 32; shift += 8)
+        {
+            memset(offsets, 0, 256 * sizeof(size_t));
+            for (size_t i = 0; i < n; i++) offsets[(keys[i] >> shift) & 0xFF]++;
+
+            if (offsets[(keys[0] >> shift) & 0xFF] == n) continue;
+
+            PrefixScanner::exclusiveScan(offsets, offsets, 256);
+
+            for (size_t i = 0; i < n; i++) buffer[offsets[(keys[i] >> shift) & 0xFF]++] = keys[i];
+
+            swap(keys, buffer);
+        }
+
+        for (size_t i = 0; i < n; i++) arr[i] = static_cast<int>(keys[i] ^ 0x80000000u);
+    }
+};
@@ -0,0 +1,231 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+/*
+    Run-Length Histogram (CountingSorter's compact output):
+    - CountingSorter::sort builds a value -> count table, then expands it back into n elements
+    - When only "which values, how many of each" is needed, the table IS the answer:
+        [3, 1, 3, 2, 3, 1]  ->  (1, 2) (2, 1) (3, 3)
+    - Size is O(k) for k distinct values instead of O(n)
+        * 10^9 rows with 4,000 distinct values: ~64 KB of runs instead of 4 GB of sorted ints
+
+    Stored as:
+    - runs: (value, count) pairs with strictly increasing values
+    - ends: running totals of the counts, ends[i] = number of elements with value <= runs[i].value
+      (the cumulative frequencies from step 2 of counting sort, kept around for rank queries)
+
+    Operations:
+    - merge: two-pointer walk like MergeSorter::merge, adding counts of equal values - O(k1 + k2)
+    - valueAt(rank) / percentile(p): binary search over `ends` - O(log k), nothing expanded
+    - begin()/end(): iterator that yields the sorted elements one at a time, repeating each value `count` times
+    - expand(): the full sorted vector (what CountingSorter::sort returns)
+*/
+
+struct ValueCount
+{
+    int value;
+    size_t count;
+};
+
+class RunLengthHistogram
+{
+public:
+    // Lazily expands the runs: *it is the current value, ++it moves one element (not one run) forward
+    class Iterator
+    {
+    public:
+        using iterator_category = forward_iterator_tag;
+        using value_type = int;
+        using difference_type = ptrdiff_t;
+        using pointer = const int*;
+        using reference = const int&;
+
+        Iterator(const vector<ValueCount>* runs, size_t run) : runs(runs), run(run), offset(0)
+        {
+        }
+
+        reference operator*() const
+        {
+            return (*runs)[run].value;
+        }
+
+        Iterator& operator++()
+        {
+            if (++offset == (*runs)[run].count)
+            {
+                run++;
+                offset = 0;
+            }
+            return *this;
+        }
+
+        Iterator operator++(int)
+        {
+            Iterator previous = *this;
+            ++*this;
+            return previous;
+        }
+
+        bool operator==(const Iterator& other) const
+        {
+            return run == other.run && offset == other.offset;
+        }
+
+        bool operator!=(const Iterator& other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        const vector<ValueCount>* runs;
+        size_t run;
+        size_t offset;
+    };
+
+    RunLengthHistogram() = default;
+
+    // runs must have strictly increasing values (throws invalid_argument otherwise); zero-count runs are dropped
+    explicit RunLengthHistogram(const vector<ValueCount>& sortedRuns)
+    {
+        for (size_t i = 1; i < sortedRuns.size(); i++)
+        {
+            if (sortedRuns[i].value <= sortedRuns[i - 1].value)
+            {
+                throw invalid_argument("RunLengthHistogram: run values must be strictly increasing (run " + to_string(i) +
+                                       " has value " + to_string(sortedRuns[i].value) + ")");
+            }
+        }
+
+        runs.reserve(sortedRuns.size());
+        ends.reserve(sortedRuns.size());
+        for (const ValueCount& run : sortedRuns) append(run.value, run.count);
+    }
+
+    static RunLengthHistogram merge(const RunLengthHistogram& a, const RunLengthHistogram& b)
+    {
+        RunLengthHistogram merged;
+        merged.runs.reserve(a.runs.size() + b.runs.size());
+        merged.ends.reserve(a.runs.size() + b.runs.size());
+
+        size_t i = 0;
+        size_t j = 0;
+
+        while (i < a.runs.size() && j < b.runs.size())
+        {
+            if (a.runs[i].value < b.runs[j].value)
+            {
+                merged.append(a.runs[i].value, a.runs[i].count);
+                i++;
+            }
+            else if (b.runs[j].value < a.runs[i].value)
+            {
+                merged.append(b.runs[j].value, b.runs[j].count);
+                j++;
+            }
+            else
+            {
+                merged.append(a.runs[i].value, a.runs[i].count + b.runs[j].count);
+                i++;
+                j++;
+            }
+        }
+
+        for (; i < a.runs.size(); i++) merged.append(a.runs[i].value, a.runs[i].count);
+        for (; j < b.runs.size(); j++) merged.append(b.runs[j].value, b.runs[j].count);
+
+        return merged;
+    }
+
+    // Total number of elements (n), not the number of runs
+    size_t size() const
+    {
+        return ends.empty() ? 0 : ends.back();
+    }
+
+    size_t distinct() const
+    {
+        return runs.size();
+    }
+
+    const vector<ValueCount>& valueCounts() const
+    {
+        return runs;
+    }
+
+    // Element at position `rank` of the sorted array, 0 <= rank < size()
+    int valueAt(size_t rank) const
+    {
+        if (rank >= size()) throw out_of_range("RunLengthHistogram: rank " + to_string(rank) + " out of range");
+
+        // First run whose running total exceeds rank
+        size_t left = 0;
+        size_t right = ends.size() - 1;
+
+        while (left < right)
+        {
+            size_t mid = left + (right - left) / 2;
+
+            if (ends[mid] <= rank) left = mid + 1;
+            else right = mid;
+        }
+
+        return runs[left].value;
+    }
+
+    // Nearest-rank percentile, p in [0, 100] (clamped; same convention as QuickSelector::percentile)
+    // Throws invalid_argument on a NaN p, out_of_range on an empty histogram
+    int percentile(double p) const
+    {
+        if (isnan(p)) throw invalid_argument("RunLengthHistogram: percentile is NaN");
+        if (runs.empty()) throw out_of_range("RunLengthHistogram: percentile of an empty histogram");
+
+        // Clamp before the cast: converting an out-of-range double to an integer is undefined
+        p = min(max(p, 0.0), 100.0);
+
+        long long n = size();
+        long long rank = static_cast<long long>(ceil(p / 100.0 * n)) - 1;
+
+        if (rank < 0) rank = 0;
+
+        return valueAt(static_cast<size_t>(rank));
+    }
+
+    Iterator begin() const
+    {
+        return Iterator(&runs, 0);
+    }
+
+    Iterator end() const
+    {
+        return Iterator(&runs, runs.size());
+    }
+
+    vector<int> expand() const
+    {
+        vector<int> output;
+        output.reserve(size());
+        for (const ValueCount& run : runs) output.insert(output.end(), run.count, run.value);
+        return output;
+    }
+
+private:
+    vector<ValueCount> runs;
+    vector<size_t> ends;
+
+    void append(int value, size_t count)
+    {
+        if (count == 0) return;
+
+        runs.push_back({value, count});
+        ends.push_back(size() + count);
+    }
+};
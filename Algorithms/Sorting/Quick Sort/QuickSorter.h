@@ -0,0 +1,225 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "../../Instrumentation/Instrumentation.h"
+
+using namespace std;
+
+/*
+    Quick Sort Properties:
+    - Divide and Conquer algorithm that selects a pivot and partitions array around it
+    - Not stable by default: may change relative order of equal elements
+    - Properties:
+        * In-place: requires only O(log n) extra space for recursion
+        * Internal sorting: all sorting done in memory
+        * Parallelizable: different partitions can be sorted independently
+        * Adaptive: performance varies based on pivot selection and input order
+*/
+
+/*
+    QuickSorter::sort() - Quick Sort Visualization
+    Example with array [64, 34, 25, 12, 22, 11, 90]
+
+    QuickSort Partitioning Process:
+    [64, 34, 25, 12, 22, 11, 90]                    // Initial array, pivot = 90
+                    |
+    [64, 34, 25, 12, 22, 11] | [90]                 // After first partition
+                    |
+    [34, 25, 12, 22, 11] | [64] | [90]              // Partition left, pivot = 64
+                    |
+    [25, 12, 22, 11] | [34] | [64] | [90]           // Continue, pivot = 34
+                    |
+    [12, 22, 11] | [25] | [34] | [64] | [90]        // Next partition, pivot = 25
+                    |
+    [11] | [12, 22] | [25] | [34] | [64] | [90]     // Continue, pivot = 22
+                    |
+    [11] | [12] | [22] | [25] | [34] | [64] | [90]  // Final partitioning
+
+    Final sorted array:
+    [11, 12, 22, 25, 34, 64, 90]                    // All elements in position
+
+    Key Operations:
+    1. Partitioning: O(n) comparisons at each level
+    2. Recursion: O(log n) levels on average
+    3. Total: O(n log n) average case comparisons
+
+    Space Complexity Analysis:
+    - No extra array needed (in-place)
+    - Recursion stack: O(log n) average case
+    - Worst case: O(n) recursion stack for unbalanced partitions
+
+    Advantages:
+    1. In-place sorting (minimal extra space)
+    2. Cache-friendly (good locality of reference)
+    3. Very fast in practice, especially on random data
+    4. Adaptive to input (works well with partially sorted arrays)
+
+    Disadvantages:
+    1. Not stable (equal elements may change order)
+    2. O(n²) worst case with poor pivot selection
+    3. Performance depends heavily on pivot choice
+    4. Deep recursion in worst case
+*/
+
+class QuickSorter
+{
+    // QuickSelector reuses partition() as the quickselect kernel, IndirectSorter for its (key, index) quicksort
+    friend class QuickSelector;
+    friend class IndirectSorter;
+
+public:
+    // Sub-arrays of at most this many elements use insertion sort; sort() reads the settable copy
+    static constexpr size_t INSERTION_SORT_CUTOFF = 16;
+    static inline size_t insertionSortCutoff = INSERTION_SORT_CUTOFF;
+
+    // Works for any element type with `<=` (e.g. int, or the KeyIndex pairs used by IndirectSorter)
+    template <typename T>
+    static void sort(vector<T>& arr)
+    {
+        if (arr.empty()) return;
+
+        // Read the cutoff once per sort, not once per recursive call
+        sort(arr, 0, arr.size() - 1, insertionSortCutoff);
+    }
+
+    /*
+        Compile-time variant for fixed tables (std::array, C++17 constexpr):
+            constexpr auto codes = QuickSorter::sorted(array<int, 5>{404, 200, 500, 301, 418});
+            static_assert(codes[0] == 200);
+        - Same Lomuto partition as below; no instrumentation (the counters are not constexpr)
+        - Recurses into the smaller side and loops on the larger one: recursion depth stays O(log n) even for
+          already-sorted tables, well inside the compiler's constexpr depth limit
+    */
+    template <typename T, size_t N>
+    static constexpr void sort(array<T, N>& arr)
+    {
+        sort(arr, 0, static_cast<int>(N) - 1);
+    }
+
+    template <typename T, size_t N>
+    static constexpr array<T, N> sorted(array<T, N> arr)
+    {
+        sort(arr);
+        return arr;
+    }
+
+private:
+    template <typename T, size_t N>
+    static constexpr void sort(array<T, N>& arr, int low, int high)
+    {
+        while (low < high)
+        {
+            int pivot = partition(arr, low, high);
+
+            if (pivot - low < high - pivot)
+            {
+                sort(arr, low, pivot - 1);
+                low = pivot + 1;
+            }
+            else
+            {
+                sort(arr, pivot + 1, high);
+                high = pivot - 1;
+            }
+        }
+    }
+
+    template <typename T, size_t N>
+    static constexpr int partition(array<T, N>& arr, int low, int high)
+    {
+        T pivot = arr[high];
+        int i = low - 1;
+
+        for (int j = low; j < high; j++)
+        {
+            if (arr[j] <= pivot) swapValues(arr[++i], arr[j]);
+        }
+
+        swapValues(arr[i + 1], arr[high]);
+        return i + 1;
+    }
+
+    // std::swap is not constexpr until C++20
+    template <typename T>
+    static constexpr void swapValues(T& a, T& b)
+    {
+        T temp = a;
+        a = b;
+        b = temp;
+    }
+
+    template <typename T>
+    static void sort(vector<T>& arr, int low, int high, size_t insertionCutoff)
+    {
+        if (low >= high) return; // Base case: 0 or 1 element
+
+        // Small sub-arrays: insertion sort beats further partitioning (cutoff measured by the Calibrator)
+        if (static_cast<size_t>(high - low + 1) <= insertionCutoff)
+        {
+            insertionSort(arr, low, high);
+            return;
+        }
+
+        INSTRUMENT_RECURSION_SCOPE();
+
+        // Partition array and get pivot position
+        int pivot = partition(arr, low, high);
+        INSTRUMENT_PARTITION(low, pivot, high);
+
+        // Recursively sort sub-arrays
+        sort(arr, low, pivot - 1, insertionCutoff);  // Sort left of pivot
+        sort(arr, pivot + 1, high, insertionCutoff); // Sort right of pivot
+    }
+
+    template <typename T>
+    static void insertionSort(vector<T>& arr, int low, int high)
+    {
+        for (int i = low + 1; i <= high; i++)
+        {
+            T value = arr[i];
+            int j = i;
+
+            while (j > low)
+            {
+                INSTRUMENT_COMPARISON();
+                if (arr[j - 1] <= value) break;
+
+                arr[j] = arr[j - 1];
+                INSTRUMENT_MOVES(1);
+                j--;
+            }
+
+            arr[j] = value;
+        }
+    }
+
+    template <typename T>
+    static int partition(vector<T>& arr, int low, int high)
+    {
+        T pivot = arr[high]; // Choose rightmost element as pivot
+
+        int i = low - 1; // Index of smaller element
+
+        // Place elements smaller than pivot to the left
+        for (int j = low; j < high; j++)
+        {
+            INSTRUMENT_COMPARISON();
+            if (arr[j] <= pivot)
+            {
+                i++;
+                swap(arr[i], arr[j]);
+                INSTRUMENT_SWAP();
+            }
+        }
+
+        // Place pivot in its final position
+        swap(arr[i + 1], arr[high]);
+        INSTRUMENT_SWAP();
+
+        return i + 1;
+    }
+};
@@ -0,0 +1,105 @@
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "../../Benchmarking/InputGenerators.h"
+#include "../Merge Sort/MergeSorter.h"
+#include "../Non-Comparison Element Count/CountingSorter.h"
+#include "../Sorter Context/SorterContext.h"
+#include "SampleSorter.h"
+
+using namespace std;
+
+template <typename Function>
+double timeMs(Function function)
+{
+    auto start = chrono::steady_clock::now();
+    function();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char* argv[])
+{
+    // Example 1: the visualization from SampleSorter.h
+    vector<int> small = {71, 12, 50, 33, 5, 88, 49, 60};
+    SampleSorter::sort(small, 2);
+
+    cout << "Example 1 - Two workers\n";
+    cout << "-----------------------\n";
+    for (int value : small) cout << value << " ";
+    cout << "\n";
+    assert(small == vector<int>({5, 12, 33, 49, 50, 60, 71, 88}));
+
+    // Example 2: every input distribution and worker count against the single-process sorters
+    for (Distribution distribution : InputGenerator::all())
+    {
+        vector<int> original = InputGenerator::generate(distribution, 20000);
+
+        vector<int> expected = original;
+        MergeSorter::sort(expected);
+
+        vector<int> counted = original;
+        SorterContext context;
+        CountingSorter::sort(counted, context);
+        assert(counted == expected);
+
+        for (int workers : {1, 2, 3, 5, 8})
+        {
+            vector<int> sorted = original;
+            SampleSorter::sort(sorted, workers);
+            assert(sorted == expected);
+
+            // QuickSorter shards: random input only (rightmost pivot is quadratic on ordered shards)
+            if (distribution == Distribution::Random)
+            {
+                vector<int> quick = original;
+                SampleSorter::sort(quick, workers, LocalSortAlgorithm::Quick);
+                assert(quick == expected);
+            }
+        }
+    }
+
+    // Tiny inputs: fewer elements than workers
+    for (int n = 0; n < 6; n++)
+    {
+        vector<int> tiny(n);
+        for (int i = 0; i < n; i++) tiny[i] = (7 * i) % 5 - 2;
+        vector<int> expected = tiny;
+        MergeSorter::sort(expected);
+
+        SampleSorter::sort(tiny, 4);
+        assert(tiny == expected);
+    }
+
+    // Example 3: scaling from 1 to N workers
+    int maxWorkers = argc > 1 ? atoi(argv[1]) : max(4u, thread::hardware_concurrency());
+    size_t n = 1 << 23;
+    vector<int> original = InputGenerator::generate(Distribution::Random, n);
+
+    vector<int> baseline = original;
+    SorterContext context;
+    double baselineMs = timeMs([&]() { CountingSorter::sort(baseline, context); });
+
+    cout << "\nExample 3 - " << n << " random ints (" << thread::hardware_concurrency() << " hardware threads)\n";
+    cout << "---------------------------------------------------\n";
+    cout << left << setw(36) << "CountingSorter (1 process)" << right << fixed << setprecision(1) << setw(9) << baselineMs << " ms\n";
+
+    for (int workers = 1; workers <= maxWorkers; workers *= 2)
+    {
+        vector<int> sorted = original;
+        double sampleMs = timeMs([&]() { SampleSorter::sort(sorted, workers); });
+        assert(sorted == baseline);
+
+        cout << left << setw(36) << ("SampleSorter, " + to_string(workers) + " workers") << right << setw(9) << sampleMs
+             << " ms   speedup " << setprecision(2) << baselineMs / sampleMs << "x\n" << setprecision(1);
+    }
+
+    cout << "\nAssertion passed: sample sort matches the single-process sorters!" << endl;
+
+    return 0;
+}
@@ -0,0 +1,242 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "../../Searching/Binary Search/IterativeBinarySearcher.h"
+#include "../Non-Comparison Element Count/CountingSorter.h"
+#include "../Quick Sort/QuickSorter.h"
+#include "../Sorter Context/SorterContext.h"
+
+using namespace std;
+
+/*
+    Multi-Process Sample Sort (POSIX shared memory):
+    - Threads share one address space, one allocator, one NUMA node's page placement decisions
+    - Worker PROCESSES can each be pinned to a node (numactl, taskset) and own their memory; they exchange data
+      through named shared-memory segments (shm_open + mmap) instead of pointers
+
+    Algorithm with p workers:
+    1. Splitters (parent): take p * OVERSAMPLING random elements, sort them, keep every OVERSAMPLING-th
+       -> p - 1 splitters that cut the value range into p buckets of roughly n / p elements each
+    2. Phase 1 (p forked workers): worker w
+        * sorts its shard input[w * n / p, (w + 1) * n / p) with the local sorter (CountingSorter's radix path
+          or QuickSorter)
+        * finds where each splitter falls in the sorted shard (findInsertionPoint) -> p bucket boundaries
+        * writes the boundaries into the shared `boundaries` matrix
+    3. Phase 2 (p forked workers): worker b
+        * bucket b's offset in the output = total size of buckets 0..b-1 (summed from the matrix)
+        * copies its piece of every shard (already sorted runs) into output[offset, ...) and sorts that partition
+          with CountingSorter's radix path (concatenated sorted runs are QuickSorter's rightmost-pivot worst case)
+    4. Parent copies the output segment back into arr
+
+    Visualization (p = 2, splitter 50):
+        shards:   [71, 12, 50, 33]  [5, 88, 49, 60]
+        phase 1:  [12, 33 | 50, 71]  [5, 49 | 60, 88]       (sorted, cut at the first element >= 50)
+        phase 2:  bucket 0 = [12, 33, 5, 49] -> [5, 12, 33, 49]
+                  bucket 1 = [50, 71, 60, 88] -> [50, 60, 71, 88]
+
+    Shared memory:
+    - Segments are unlinked right after mmap: forked children inherit the mapping, and no name is left behind in
+      /dev/shm if a worker crashes
+    - Workers leave with _exit() so the parent's destructors and stdio buffers are not run twice
+    - A worker that fails exits non-zero; the parent turns that into an exception
+
+    Caveat: heavy duplicates of one splitter value all land in one bucket (the worker after that splitter does more)
+
+    Time Complexity: O(n / p * local sort) per worker + O(p^2) bookkeeping
+    Space Complexity: 2n ints of shared memory + one shard/bucket of private memory per worker
+*/
+
+enum class LocalSortAlgorithm
+{
+    Counting,
+    Quick
+};
+
+class SampleSorter
+{
+public:
+    static const int OVERSAMPLING = 32;
+
+    // `local` picks the phase-1 shard sorter
+    static void sort(vector<int>& arr, int workers, LocalSortAlgorithm local = LocalSortAlgorithm::Counting)
+    {
+        size_t n = arr.size();
+        if (n < 2) return;
+        if (workers < 1) workers = 1;
+
+        vector<int> splitters = chooseSplitters(arr, workers);
+
+        SharedSegment input(n * sizeof(int));
+        SharedSegment output(n * sizeof(int));
+        SharedSegment boundaries(static_cast<size_t>(workers) * (workers + 1) * sizeof(int64_t));
+
+        int* in = static_cast<int*>(input.data);
+        int* out = static_cast<int*>(output.data);
+        int64_t* cuts = static_cast<int64_t*>(boundaries.data);
+
+        memcpy(in, arr.data(), n * sizeof(int));
+
+        // Phase 1: sort each shard, record where every splitter cuts it
+        runWorkers(workers, [&](int w) {
+            size_t start = shardStart(n, workers, w);
+            size_t end = shardStart(n, workers, w + 1);
+
+            vector<int> shard(in + start, in + end);
+            localSort(shard, local);
+            copy(shard.begin(), shard.end(), in + start);
+
+            int64_t* row = cuts + static_cast<size_t>(w) * (workers + 1);
+            row[0] = 0;
+            for (int b = 0; b + 1 < workers; b++) row[b + 1] = IterativeHalvingBinarySearcher::findInsertionPoint(shard, splitters[b]);
+            row[workers] = static_cast<int64_t>(shard.size());
+        });
+
+        // Phase 2: gather bucket b from every shard, sort it into its final place
+        runWorkers(workers, [&](int b) {
+            size_t offset = 0;
+            for (int w = 0; w < workers; w++)
+            {
+                const int64_t* row = cuts + static_cast<size_t>(w) * (workers + 1);
+                offset += row[b] - row[0];
+            }
+
+            vector<int> bucket;
+            for (int w = 0; w < workers; w++)
+            {
+                const int64_t* row = cuts + static_cast<size_t>(w) * (workers + 1);
+                const int* shard = in + shardStart(n, workers, w);
+                bucket.insert(bucket.end(), shard + row[b], shard + row[b + 1]);
+            }
+
+            localSort(bucket, LocalSortAlgorithm::Counting);
+            copy(bucket.begin(), bucket.end(), out + offset);
+        });
+
+        memcpy(arr.data(), out, n * sizeof(int));
+    }
+
+private:
+    // One mapped POSIX shared-memory segment, unlinked as soon as it is mapped
+    struct SharedSegment
+    {
+        void* data = nullptr;
+        size_t bytes;
+
+        explicit SharedSegment(size_t bytes) : bytes(bytes > 0 ? bytes : 1)
+        {
+            static int counter = 0;
+            string name = "/sample-sort-" + to_string(getpid()) + "-" + to_string(counter++);
+
+            int fd = shm_open(name.c_str(), O_CREAT | O_EXCL | O_RDWR, 0600);
+            if (fd < 0) throw runtime_error("SampleSorter: shm_open failed for " + name);
+
+            if (ftruncate(fd, this->bytes) != 0)
+            {
+                close(fd);
+                shm_unlink(name.c_str());
+                throw runtime_error("SampleSorter: ftruncate failed for " + name);
+            }
+
+            data = mmap(nullptr, this->bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+            close(fd);
+            shm_unlink(name.c_str());
+
+            if (data == MAP_FAILED) throw runtime_error("SampleSorter: mmap failed for " + name);
+        }
+
+        ~SharedSegment()
+        {
+            munmap(data, bytes);
+        }
+
+        SharedSegment(const SharedSegment&) = delete;
+        SharedSegment& operator=(const SharedSegment&) = delete;
+    };
+
+    static size_t shardStart(size_t n, int workers, int w)
+    {
+        return n * w / workers;
+    }
+
+    static vector<int> chooseSplitters(const vector<int>& arr, int workers)
+    {
+        mt19937 rng(42);
+        uniform_int_distribution<size_t> position(0, arr.size() - 1);
+
+        vector<int> sample(static_cast<size_t>(workers) * OVERSAMPLING);
+        for (int& value : sample) value = arr[position(rng)];
+        QuickSorter::sort(sample);
+
+        vector<int> splitters;
+        for (int b = 1; b < workers; b++) splitters.push_back(sample[b * OVERSAMPLING]);
+        return splitters;
+    }
+
+    static void localSort(vector<int>& arr, LocalSortAlgorithm local)
+    {
+        if (local == LocalSortAlgorithm::Quick)
+        {
+            QuickSorter::sort(arr);
+            return;
+        }
+
+        SorterContext context;
+        CountingSorter::sort(arr, context);
+    }
+
+    // Forks one child per worker index and waits for all of them
+    template <typename Work>
+    static void runWorkers(int workers, Work work)
+    {
+        vector<pid_t> children;
+        bool failed = false;
+
+        for (int w = 0; w < workers; w++)
+        {
+            pid_t pid = fork();
+
+            if (pid == 0)
+            {
+                int status = 0;
+                try
+                {
+                    work(w);
+                }
+                catch (...)
+                {
+                    status = 1;
+                }
+                _exit(status);
+            }
+
+            if (pid < 0)
+            {
+                failed = true;
+                break;
+            }
+
+            children.push_back(pid);
+        }
+
+        for (pid_t child : children)
+        {
+            int status = 0;
+            if (waitpid(child, &status, 0) != child || !WIFEXITED(status) || WEXITSTATUS(status) != 0) failed = true;
+        }
+
+        if (failed) throw runtime_error("SampleSorter: a worker process failed");
+    }
+};
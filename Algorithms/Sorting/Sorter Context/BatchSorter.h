@@ -0,0 +1,47 @@
+#pragma once
+
+#include <vector>
+
+#include "../Merge Sort/MergeSorter.h"
+#include "../Non-Comparison Element Count/CountingSorter.h"
+#include "../Quick Sort/QuickSorter.h"
+#include "SorterContext.h"
+
+using namespace std;
+
+/*
+    Batch Sorting:
+    - Sorts many independent small arrays back-to-back through ONE SorterContext
+    - The arena warms up to the largest array in the first batch; every later sort reuses that memory
+    - QuickSorter sorts in place with no heap use, so it ignores the context
+*/
+
+enum class BatchAlgorithm
+{
+    Quick,
+    Merge,
+    Counting
+};
+
+class BatchSorter
+{
+public:
+    static void sortBatch(vector<vector<int>>& arrays, SorterContext& context, BatchAlgorithm algorithm = BatchAlgorithm::Merge)
+    {
+        for (vector<int>& arr : arrays)
+        {
+            switch (algorithm)
+            {
+                case BatchAlgorithm::Quick:
+                    QuickSorter::sort(arr);
+                    break;
+                case BatchAlgorithm::Merge:
+                    MergeSorter::sort(arr, context);
+                    break;
+                case BatchAlgorithm::Counting:
+                    CountingSorter::sort(arr, context);
+                    break;
+            }
+        }
+    }
+};
@@ -0,0 +1,111 @@
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <random>
+#include <vector>
+
+#include "BatchSorter.h"
+
+using namespace std;
+
+// Global allocation counter: proves the steady state really performs zero heap allocations
+static size_t heapAllocations = 0;
+
+void* operator new(size_t size)
+{
+    heapAllocations++;
+    if (void* memory = malloc(size)) return memory;
+    throw bad_alloc();
+}
+
+void operator delete(void* memory) noexcept
+{
+    free(memory);
+}
+
+void operator delete(void* memory, size_t) noexcept
+{
+    free(memory);
+}
+
+// Request-handler-like workload: many arrays of 10-500 elements, mixed value ranges
+vector<vector<int>> makeBatch(size_t count, unsigned seed)
+{
+    mt19937 rng(seed);
+    uniform_int_distribution<int> length(10, 500);
+    uniform_int_distribution<int> smallValues(0, 100);
+    uniform_int_distribution<int> wideValues(-1000000000, 1000000000);
+
+    vector<vector<int>> batch(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        batch[i].resize(length(rng));
+        for (int& value : batch[i]) value = (i % 2 == 0) ? smallValues(rng) : wideValues(rng);
+    }
+    return batch;
+}
+
+int main()
+{
+    const size_t arrays = 20000;
+    vector<vector<int>> original = makeBatch(arrays, 1);
+
+    vector<vector<int>> expected = original;
+    for (vector<int>& arr : expected) std::sort(arr.begin(), arr.end());
+
+    cout << "Sorter Context - " << arrays << " arrays of 10-500 elements\n";
+    cout << "--------------------------------------------------\n";
+
+    // Baseline: per-call allocations
+    vector<vector<int>> batch = original;
+    size_t before = heapAllocations;
+    auto start = chrono::steady_clock::now();
+    for (vector<int>& arr : batch) MergeSorter::sort(arr);
+    double plainMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << left << setw(36) << "MergeSorter::sort(arr)" << right << fixed << setprecision(1) << setw(8) << plainMs << " ms  "
+         << setw(9) << heapAllocations - before << " heap allocations\n";
+    assert(batch == expected);
+
+    batch = original;
+    before = heapAllocations;
+    start = chrono::steady_clock::now();
+    for (vector<int>& arr : batch) arr = CountingSorter::sort(arr);
+    plainMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+    cout << left << setw(36) << "CountingSorter::sort(arr)" << right << setw(8) << plainMs << " ms  " << setw(9) << heapAllocations - before
+         << " heap allocations\n";
+    assert(batch == expected);
+
+    // Context: warm the arena up once, then measure the steady state
+    SorterContext context;
+
+    vector<pair<string, BatchAlgorithm>> algorithms = {{"BatchSorter (Merge, context)", BatchAlgorithm::Merge},
+                                                       {"BatchSorter (Counting, context)", BatchAlgorithm::Counting}};
+
+    for (const auto& algorithm : algorithms)
+    {
+        vector<vector<int>> warmup = original;
+        BatchSorter::sortBatch(warmup, context, algorithm.second);
+
+        batch = original;
+        before = heapAllocations;
+        start = chrono::steady_clock::now();
+        BatchSorter::sortBatch(batch, context, algorithm.second);
+        double contextMs = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        size_t steadyAllocations = heapAllocations - before;
+
+        cout << left << setw(36) << algorithm.first << right << setw(8) << contextMs << " ms  " << setw(9) << steadyAllocations
+             << " heap allocations\n";
+
+        assert(batch == expected);
+        assert(steadyAllocations == 0);
+    }
+
+    cout << "\nArena capacity: " << context.capacity() << " bytes after " << context.heapAllocations() << " arena allocations\n";
+    cout << "Assertion passed: steady-state batch sorting performs zero heap allocations!" << endl;
+
+    return 0;
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+using namespace std;
+
+/*
+    Sorter Context (Reusable Scratch Arena):
+    - Problem: sorting millions of tiny arrays per second
+        * MergeSorter::merge allocates leftArr/rightArr on EVERY merge (~n allocations per sort)
+        * CountingSorter::sort allocates a map node per distinct value plus the output vector on every call
+        * For a 50-element array, malloc/free can cost more than the sort itself
+    - Idea: one context object owns a growable scratch arena that outlives individual sort calls
+        * Sorters take memory from the arena with a bump pointer - no heap calls
+        * reset() at the start of each sort rewinds the pointer; the memory is kept
+        * Once the arena has grown to the largest working set seen, steady-state sorting performs ZERO heap allocations
+
+    Growth:
+    - If a request does not fit, a new block is chained on (earlier pointers stay valid for the current sort)
+    - On the next reset() the chained blocks are coalesced into one block of their total size,
+      so the same working set fits in a single block from then on
+
+    Rules:
+    - Scratch pointers are valid until the next reset() - i.e. until the next sort call using this context
+    - Only trivially copyable element types (int, KeyIndex, ...) may live in the arena
+    - One context per thread: the arena is not synchronized
+*/
+
+class SorterContext
+{
+public:
+    explicit SorterContext(size_t initialBytes = 0)
+    {
+        if (initialBytes > 0) addBlock(initialBytes);
+    }
+
+    SorterContext(const SorterContext&) = delete;
+    SorterContext& operator=(const SorterContext&) = delete;
+
+    // Releases every scratch allocation of the previous sort (keeping the memory)
+    void reset()
+    {
+        if (blocks.size() > 1)
+        {
+            size_t total = 0;
+            for (const Block& block : blocks) total += block.size;
+
+            blocks.clear();
+            addBlock(total);
+        }
+
+        currentBlock = 0;
+        offset = 0;
+    }
+
+    // Uninitialized space for `count` elements of T, valid until the next reset()
+    template <typename T>
+    T* allocate(size_t count)
+    {
+        static_assert(is_trivially_copyable<T>::value, "SorterContext only holds trivially copyable types");
+        static_assert(alignof(T) <= ALIGNMENT, "SorterContext alignment is too small for this type");
+
+        if (count == 0) return nullptr;
+
+        size_t bytes = roundUp(count * sizeof(T));
+
+        while (currentBlock < blocks.size() && offset + bytes > blocks[currentBlock].size)
+        {
+            currentBlock++;
+            offset = 0;
+        }
+
+        if (currentBlock == blocks.size())
+        {
+            size_t previous = blocks.empty() ? 0 : blocks.back().size;
+            addBlock(max(bytes, 2 * previous));
+            offset = 0;
+        }
+
+        unsigned char* result = blocks[currentBlock].data.get() + offset;
+        offset += bytes;
+
+        return reinterpret_cast<T*>(result);
+    }
+
+    // Total bytes owned by the arena
+    size_t capacity() const
+    {
+        size_t total = 0;
+        for (const Block& block : blocks) total += block.size;
+        return total;
+    }
+
+    // Number of heap allocations the arena has ever made - stops growing once warmed up
+    size_t heapAllocations() const
+    {
+        return allocationCount;
+    }
+
+private:
+    static const size_t ALIGNMENT = alignof(max_align_t);
+
+    struct Block
+    {
+        unique_ptr<unsigned char[]> data;
+        size_t size;
+    };
+
+    vector<Block> blocks;
+    size_t currentBlock = 0;
+    size_t offset = 0;
+    size_t allocationCount = 0;
+
+    static size_t roundUp(size_t bytes)
+    {
+        return (bytes + ALIGNMENT - 1) / ALIGNMENT * ALIGNMENT;
+    }
+
+    void addBlock(size_t bytes)
+    {
+        blocks.reserve(4);
+        blocks.push_back({unique_ptr<unsigned char[]>(new unsigned char[bytes]), bytes});
+        allocationCount++;
+    }
+};
@@ -0,0 +1,101 @@
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../Merge Sort/MergeSorter.h"
+#include "StringSorter.h"
+
+using namespace std;
+
+// URL-like keys: long shared prefixes, a few hosts, random paths - the worst case for comparison sorts
+vector<string> makeUrls(size_t n)
+{
+    mt19937 rng(42);
+    vector<string> hosts = {"https://www.example.com/", "https://api.example.com/v2/", "https://cdn.example.org/assets/", "http://a.io/"};
+    uniform_int_distribution<size_t> host(0, hosts.size() - 1);
+    uniform_int_distribution<int> letter('a', 'z');
+    uniform_int_distribution<int> length(1, 24);
+
+    vector<string> urls(n);
+    for (string& url : urls)
+    {
+        url = hosts[host(rng)];
+        int segments = length(rng);
+        for (int i = 0; i < segments; i++) url += static_cast<char>(letter(rng));
+    }
+    return urls;
+}
+
+template <typename Function>
+double timeMs(Function function)
+{
+    auto start = chrono::steady_clock::now();
+    function();
+    return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+}
+
+int main()
+{
+    // Example 1: small word list, including empty strings, prefixes and duplicates
+    vector<string> words = {"banana", "band", "ban", "", "apple", "bandana", "app", "banana", "b", "applesauce", ""};
+    cout << "Example 1 - Words\n";
+    cout << "-----------------\n";
+    StringSorter::sort(words);
+    for (const string& word : words) cout << "\"" << word << "\" ";
+    cout << "\n\n";
+    assert(is_sorted(words.begin(), words.end()));
+
+    // Example 2: URLs - MSD radix vs multikey quicksort vs comparison sorts
+    size_t n = 300000;
+    vector<string> urls = makeUrls(n);
+    vector<string_view> original(urls.begin(), urls.end());
+
+    vector<string_view> expected = original;
+    double stdMs = timeMs([&]() { std::sort(expected.begin(), expected.end()); });
+
+    vector<string_view> merged = original;
+    double mergeMs = timeMs([&]() { MergeSorter::sort(merged); });
+
+    vector<string_view> radix = original;
+    double radixMs = timeMs([&]() { StringSorter::sort(radix); });
+
+    vector<string_view> multikey = original;
+    double multikeyMs = timeMs([&]() { StringSorter::multikeyQuicksort(multikey); });
+
+    cout << "Example 2 - " << n << " URLs\n";
+    cout << "--------------------------\n";
+    cout << left << setw(34) << "std::sort" << right << fixed << setprecision(1) << setw(8) << stdMs << " ms\n";
+    cout << left << setw(34) << "MergeSorter" << right << setw(8) << mergeMs << " ms\n";
+    cout << left << setw(34) << "StringSorter (MSD radix)" << right << setw(8) << radixMs << " ms\n";
+    cout << left << setw(34) << "StringSorter (multikey quicksort)" << right << setw(8) << multikeyMs << " ms\n";
+
+    assert(merged == expected);
+    assert(radix == expected);
+    assert(multikey == expected);
+
+    // Example 3: one very long shared prefix (exercises cache refills and the depth-advance loop)
+    vector<string> longKeys(5000, string(3000, 'x'));
+    mt19937 rng(1);
+    for (string& key : longKeys) key += to_string(rng() % 1000);
+    vector<string> longExpected = longKeys;
+    std::sort(longExpected.begin(), longExpected.end());
+    vector<const char*> buffers;
+    for (const string& key : longKeys) buffers.push_back(key.data());
+    std::sort(buffers.begin(), buffers.end());
+
+    StringSorter::sort(longKeys);
+    assert(longKeys == longExpected);
+
+    // Owning strings are moved, not copied: every sorted string still owns one of the original heap buffers
+    for (const string& key : longKeys) assert(binary_search(buffers.begin(), buffers.end(), key.data()));
+
+    cout << "\nAssertion passed: all string sorts match std::sort!" << endl;
+
+    return 0;
+}
@@ -0,0 +1,277 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+using namespace std;
+
+/*
+    String Sorting (MSD Radix + Multikey Quicksort):
+    - Comparison sorts on strings re-compare shared prefixes over and over
+        * "https://example.com/a" vs "https://example.com/b" costs 21 character compares, every single time
+        * QuickSorter/MergeSorter do O(n log n) such comparisons
+    - CountingSorter's idea applied one character at a time:
+        * Bucket strings by their character at position `depth` (256 buckets + 1 for "string ended")
+        * Recurse into each bucket with depth + 1 - every character is inspected about once
+    - Strings are string_views (pointer + length): sorting moves 24-byte entries (16-byte view + 8-byte cached
+      prefix, 32 bytes with the input index for owning strings), never the bytes
+    - Owning strings are sorted the same way, then moved into place once (no character copies)
+
+    Engine:
+    1. MSD radix, American-flag variant: count bucket sizes, then permute IN PLACE by cycling each element
+       straight into its bucket (no n-sized output array like CountingSorter::sort)
+    2. Small buckets (< 32 strings) switch to three-way multikey quicksort (Bentley-Sedgewick):
+           < pivot char | == pivot char | > pivot char
+           same depth     depth + 1       same depth
+       Lomuto-style single sweep like QuickSorter::partition, extended to three regions
+    3. Runs of equal characters across the WHOLE range (long common prefixes like "https://") just advance depth in a
+       loop - no bucket pass, no recursion
+
+    Prefix caching (avoids pointer-chasing):
+    - Each entry stores 8 bytes of its string, starting at `cacheDepth`, packed big-endian into a uint64_t
+    - charAt() for depths cacheDepth..cacheDepth+7 reads the entry itself instead of dereferencing the string
+    - When a bucket's depth moves past the cache, it refills the 8 bytes in one sequential pass over that bucket
+
+    Time Complexity: O(D + n log 256) where D = total length of distinguishing prefixes
+    Space Complexity: O(n) for the cached entries, O(max depth) stack
+*/
+
+class StringSorter
+{
+public:
+    static void sort(vector<string_view>& strings)
+    {
+        if (strings.size() < 2) return;
+
+        vector<Entry> entries(strings.size());
+        for (size_t i = 0; i < strings.size(); i++) entries[i] = {loadPrefix(strings[i], 0), strings[i]};
+
+        msdRadixSort(entries, 0, entries.size(), 0, 0);
+
+        for (size_t i = 0; i < strings.size(); i++) strings[i] = entries[i].str;
+    }
+
+    /*
+        Sorts owning strings without copying any characters:
+        - The entries remember each string's original index; the engine sorts them like views
+        - The permutation is then applied in place by following its cycles: each string is MOVED once
+          (a pointer swap for heap strings), and one string is held aside per cycle
+    */
+    static void sort(vector<string>& strings)
+    {
+        if (strings.size() < 2) return;
+
+        vector<IndexedEntry> entries(strings.size());
+        for (size_t i = 0; i < strings.size(); i++) entries[i] = {{loadPrefix(strings[i], 0), strings[i]}, i};
+
+        msdRadixSort(entries, 0, entries.size(), 0, 0);
+
+        // Slot i receives strings[entries[i].index]; a finished slot is marked with index == i
+        for (size_t start = 0; start < entries.size(); start++)
+        {
+            if (entries[start].index == start) continue;
+
+            string held = move(strings[start]);
+            size_t slot = start;
+            while (entries[slot].index != start)
+            {
+                size_t source = entries[slot].index;
+                strings[slot] = move(strings[source]);
+                entries[slot].index = slot;
+                slot = source;
+            }
+            strings[slot] = move(held);
+            entries[slot].index = slot;
+        }
+    }
+
+    // Multikey quicksort alone (used internally for small buckets); exposed for comparison
+    static void multikeyQuicksort(vector<string_view>& strings)
+    {
+        vector<Entry> entries(strings.size());
+        for (size_t i = 0; i < strings.size(); i++) entries[i] = {loadPrefix(strings[i], 0), strings[i]};
+
+        multikeyQuicksort(entries, 0, entries.size(), 0, 0);
+
+        for (size_t i = 0; i < strings.size(); i++) strings[i] = entries[i].str;
+    }
+
+private:
+    struct Entry
+    {
+        uint64_t prefix; // bytes str[cacheDepth .. cacheDepth + 7], big-endian, zero-padded
+        string_view str;
+    };
+
+    // sort(vector<string>&): the entry also carries its string's position in the input
+    struct IndexedEntry : Entry
+    {
+        size_t index;
+    };
+
+    static const size_t SMALL_BUCKET = 32;
+    static const size_t INSERTION_SORT_SIZE = 8;
+    static const size_t CACHED_BYTES = 8;
+    static const int BUCKETS = 257; // bucket 0 = string ended, bucket c + 1 = byte c
+
+    static uint64_t loadPrefix(string_view str, size_t depth)
+    {
+        uint64_t prefix = 0;
+        for (size_t i = 0; i < CACHED_BYTES; i++)
+        {
+            uint64_t byte = depth + i < str.size() ? static_cast<unsigned char>(str[depth + i]) : 0;
+            prefix = (prefix << 8) | byte;
+        }
+        return prefix;
+    }
+
+    // Character at `depth` as a bucket number: 0 when the string has ended, byte + 1 otherwise
+    static int charAt(const Entry& entry, size_t depth, size_t cacheDepth)
+    {
+        if (depth >= entry.str.size()) return 0;
+
+        size_t offset = depth - cacheDepth;
+        return static_cast<int>((entry.prefix >> (8 * (CACHED_BYTES - 1 - offset))) & 0xFF) + 1;
+    }
+
+    // Refill the cache of entries[lo..hi) when depth has moved past the cached window
+    template <typename EntryType>
+    static void refreshCache(vector<EntryType>& entries, size_t lo, size_t hi, size_t depth, size_t& cacheDepth)
+    {
+        if (depth - cacheDepth < CACHED_BYTES) return;
+
+        for (size_t i = lo; i < hi; i++) entries[i].prefix = loadPrefix(entries[i].str, depth);
+        cacheDepth = depth;
+    }
+
+    template <typename EntryType>
+    static void msdRadixSort(vector<EntryType>& entries, size_t lo, size_t hi, size_t depth, size_t cacheDepth)
+    {
+        while (hi - lo >= SMALL_BUCKET)
+        {
+            refreshCache(entries, lo, hi, depth, cacheDepth);
+
+            // 1. Count bucket sizes (as in CountingSorter)
+            size_t count[BUCKETS] = {};
+            for (size_t i = lo; i < hi; i++) count[charAt(entries[i], depth, cacheDepth)]++;
+
+            // Everyone shares this character: advance depth without moving anything
+            int only = charAt(entries[lo], depth, cacheDepth);
+            if (count[only] == hi - lo)
+            {
+                if (only == 0) return; // all strings ended - all equal
+                depth++;
+                continue;
+            }
+
+            // 2. Bucket boundaries from cumulative counts
+            size_t next[BUCKETS];
+            size_t end[BUCKETS];
+            size_t sum = lo;
+            for (int b = 0; b < BUCKETS; b++)
+            {
+                next[b] = sum;
+                sum += count[b];
+                end[b] = sum;
+            }
+
+            // 3. American flag permutation: swap each element directly into its bucket, in place
+            for (int b = 0; b < BUCKETS; b++)
+            {
+                while (next[b] < end[b])
+                {
+                    EntryType entry = entries[next[b]];
+                    int c = charAt(entry, depth, cacheDepth);
+
+                    while (c != b)
+                    {
+                        swap(entry, entries[next[c]++]);
+                        c = charAt(entry, depth, cacheDepth);
+                    }
+
+                    entries[next[b]++] = entry;
+                }
+            }
+
+            // 4. Recurse into each bucket one character deeper (bucket 0 = ended strings, already equal)
+            size_t start = lo + count[0];
+            for (int b = 1; b < BUCKETS; b++)
+            {
+                if (count[b] > 1) msdRadixSort(entries, start, start + count[b], depth + 1, cacheDepth);
+                start += count[b];
+            }
+            return;
+        }
+
+        multikeyQuicksort(entries, lo, hi, depth, cacheDepth);
+    }
+
+    template <typename EntryType>
+    static void multikeyQuicksort(vector<EntryType>& entries, size_t lo, size_t hi, size_t depth, size_t cacheDepth)
+    {
+        while (hi - lo > INSERTION_SORT_SIZE)
+        {
+            refreshCache(entries, lo, hi, depth, cacheDepth);
+
+            int pivot = medianOfThree(charAt(entries[lo], depth, cacheDepth),
+                                      charAt(entries[lo + (hi - lo) / 2], depth, cacheDepth),
+                                      charAt(entries[hi - 1], depth, cacheDepth));
+
+            // Three-way partition: [lo, lt) < pivot, [lt, gt) == pivot, [gt, hi) > pivot
+            size_t lt = lo;
+            size_t i = lo;
+            size_t gt = hi;
+
+            while (i < gt)
+            {
+                int c = charAt(entries[i], depth, cacheDepth);
+
+                if (c < pivot) swap(entries[lt++], entries[i++]);
+                else if (c > pivot) swap(entries[i], entries[--gt]);
+                else i++;
+            }
+
+            multikeyQuicksort(entries, lo, lt, depth, cacheDepth);
+            multikeyQuicksort(entries, gt, hi, depth, cacheDepth);
+
+            // Middle region: same character at depth - continue one character deeper (loop instead of recursion)
+            if (pivot == 0) return; // all ended - equal strings
+            lo = lt;
+            hi = gt;
+            depth++;
+        }
+
+        insertionSort(entries, lo, hi, depth);
+    }
+
+    // Compares only from `depth` on: every string in the range shares the first `depth` characters
+    template <typename EntryType>
+    static void insertionSort(vector<EntryType>& entries, size_t lo, size_t hi, size_t depth)
+    {
+        for (size_t i = lo + 1; i < hi; i++)
+        {
+            EntryType entry = entries[i];
+            string_view suffix = entry.str.substr(min(depth, entry.str.size()));
+            size_t j = i;
+
+            while (j > lo && suffix < entries[j - 1].str.substr(min(depth, entries[j - 1].str.size())))
+            {
+                entries[j] = entries[j - 1];
+                j--;
+            }
+
+            entries[j] = entry;
+        }
+    }
+
+    static int medianOfThree(int a, int b, int c)
+    {
+        if (a > b) swap(a, b);
+        if (b > c) swap(b, c);
+        if (a > b) swap(a, b);
+        return b;
+    }
+};
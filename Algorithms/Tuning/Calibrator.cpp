@@ -0,0 +1,285 @@
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../Prefix Sum/PrefixScanner.h"
+#include "../Searching/Binary Search/IterativeBinarySearcher.h"
+#include "../Sorting/Merge Sort/MergeSorter.h"
+#include "../Sorting/Non-Comparison Element Count/CountingSorter.h"
+#include "../Sorting/Quick Sort/QuickSorter.h"
+#include "../Sorting/Sorter Context/SorterContext.h"
+#include "TuningProfile.h"
+
+using namespace std;
+
+/*
+    Calibrator: measures every TuningProfile decision point on this machine and writes the profile
+        ./Calibrator                  -> $ALGORITHMS_TUNING_PROFILE or $HOME/.algorithms-tuning-<hostname>.profile
+        ./Calibrator my.profile       -> my.profile
+    Programs on this host use the measured thresholds once they opt in at the start of main:
+        TuningProfile::loadOrDefaults(TuningProfile::defaultPath()).apply();
+
+    Each measurement is the best of REPEATS runs (the minimum filters out scheduler and page-fault noise).
+*/
+
+const int REPEATS = 5;
+
+// Hard failure, independent of NDEBUG: a wrong result must stop the profile from being written
+void require(bool condition, const string& what)
+{
+    if (!condition) throw runtime_error("Calibrator: " + what);
+}
+
+// Best of REPEATS runs of function(), in ms; setup() restores the input before each run and is not timed
+template <typename Setup, typename Function>
+double bestOfMs(Setup setup, Function function)
+{
+    double best = 1e300;
+    for (int r = 0; r < REPEATS; r++)
+    {
+        setup();
+        auto start = chrono::steady_clock::now();
+        function();
+        best = min(best, chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+    }
+    return best;
+}
+
+vector<int> randomInts(size_t n, int low, int high, unsigned seed)
+{
+    mt19937 rng(seed);
+    uniform_int_distribution<int> value(low, high);
+    vector<int> arr(n);
+    for (int& x : arr) x = value(rng);
+    return arr;
+}
+
+// secondMs < 0: single-strategy sweep, no comparison column
+void printRow(const string& setting, const string& candidate, double firstMs, double secondMs = -1)
+{
+    cout << "  " << left << setw(26) << setting << setw(12) << candidate << right << fixed << setprecision(3)
+         << setw(10) << firstMs;
+    if (secondMs >= 0) cout << setw(10) << secondMs;
+    cout << "\n";
+}
+
+// QuickSorter: the insertion-sort cutoff with the fastest sort of random ints
+size_t calibrateInsertionCutoff()
+{
+    vector<int> original = randomInts(1 << 16, INT_MIN, INT_MAX, 1);
+    vector<int> arr;
+
+    size_t bestCutoff = 0;
+    double bestMs = 1e300;
+    for (size_t cutoff : {1, 4, 8, 12, 16, 24, 32, 48, 64})
+    {
+        QuickSorter::insertionSortCutoff = cutoff;
+        double ms = bestOfMs([&]() { arr = original; }, [&]() { QuickSorter::sort(arr); });
+        printRow("quickSortInsertionCutoff", to_string(cutoff), ms);
+
+        if (ms < bestMs)
+        {
+            bestMs = ms;
+            bestCutoff = cutoff;
+        }
+    }
+    return bestCutoff;
+}
+
+// CountingSorter: largest size at which MergeSorter still beats the radix path (columns: merge, radix)
+size_t calibrateComparisonSortMax()
+{
+    const size_t total = 1 << 16;
+    SorterContext context;
+    CountingSorter::comparisonSortMaxSize = 0;
+
+    size_t best = 0;
+    for (size_t n = 8; n <= 4096; n *= 2)
+    {
+        vector<vector<int>> originals;
+        for (size_t i = 0; i < total / n; i++) originals.push_back(randomInts(n, INT_MIN, INT_MAX, static_cast<unsigned>(i)));
+        vector<vector<int>> batch;
+
+        double mergeMs = bestOfMs([&]() { batch = originals; }, [&]() {
+            for (vector<int>& arr : batch) MergeSorter::sort(arr, context);
+        });
+        double radixMs = bestOfMs([&]() { batch = originals; }, [&]() {
+            for (vector<int>& arr : batch) CountingSorter::sort(arr, context);
+        });
+        printRow("comparisonSortMaxSize", to_string(n), mergeMs, radixMs);
+
+        if (mergeMs >= radixMs) break;
+        best = n;
+    }
+    return best;
+}
+
+// CountingSorter: largest range / n ratio at which the dense count array still beats radix (columns: dense, radix)
+size_t calibrateCountingRangeFactor()
+{
+    const size_t n = 1 << 16;
+    SorterContext context;
+    vector<int> arr;
+
+    size_t best = 0;
+    for (size_t factor = 1; factor <= 256; factor *= 2)
+    {
+        vector<int> original = randomInts(n, 0, static_cast<int>(factor * n) - 1, static_cast<unsigned>(factor));
+
+        CountingSorter::countingRangeFactor = factor;
+        double denseMs = bestOfMs([&]() { arr = original; }, [&]() { CountingSorter::sort(arr, context); });
+        CountingSorter::countingRangeFactor = 0;
+        double radixMs = bestOfMs([&]() { arr = original; }, [&]() { CountingSorter::sort(arr, context); });
+        printRow("countingRangeFactor", to_string(factor), denseMs, radixMs);
+
+        if (denseMs >= radixMs) break;
+        best = factor;
+    }
+    return best;
+}
+
+// PrefixScanner: smallest input the parallel scan wins on, divided per thread (columns: serial, parallel)
+size_t calibrateParallelGrain(unsigned threads)
+{
+    const size_t largest = 1 << 22;
+    vector<long long> in(largest, 1);
+    vector<long long> out(largest);
+
+    for (size_t n = 1 << 12; n <= largest; n *= 2)
+    {
+        PrefixScanner::parallelGrain = 1;
+        double serialMs = bestOfMs([]() {}, [&]() { PrefixScanner::inclusiveScan(in.data(), out.data(), n); });
+        double parallelMs = bestOfMs([]() {}, [&]() { PrefixScanner::inclusiveScanParallel(in.data(), out.data(), n, threads); });
+        printRow("parallelGrain", to_string(n / threads), serialMs, parallelMs);
+
+        if (parallelMs < serialMs) return max<size_t>(n / threads, 1 << 10); // load() rejects grains below 1024
+    }
+
+    // Threads never paid off (e.g. a single core): only inputs beyond everything measured go parallel
+    return largest;
+}
+
+// IterativeHalvingBinarySearcher: window size below which the forward scan finishes fastest
+size_t calibrateLinearScan()
+{
+    vector<int> arr = randomInts(1 << 20, INT_MIN, INT_MAX, 3);
+    sort(arr.begin(), arr.end());
+    vector<int> targets = randomInts(1 << 17, INT_MIN, INT_MAX, 4);
+
+    size_t bestSize = 0;
+    double bestMs = 1e300;
+    long long checksum = 0;
+    for (size_t size : {0, 2, 4, 8, 16, 32, 64})
+    {
+        IterativeHalvingBinarySearcher::linearScanMaxSize = size;
+        long long sum = 0;
+        double ms = bestOfMs([&]() { sum = 0; }, [&]() {
+            for (int target : targets) sum += IterativeHalvingBinarySearcher::findInsertionPoint(arr, target);
+        });
+        printRow("linearScanMaxSize", to_string(size), ms);
+
+        // Every setting must find the same insertion points
+        if (size == 0) checksum = sum;
+        require(sum == checksum, "linearScanMaxSize=" + to_string(size) + " changed findInsertionPoint results");
+
+        if (ms < bestMs)
+        {
+            bestMs = ms;
+            bestSize = size;
+        }
+    }
+    return bestSize;
+}
+
+// The calibrated thresholds must not change any result
+void checkAlgorithms()
+{
+    SorterContext context;
+    for (size_t n : {0, 1, 2, 5, 17, 63, 64, 65, 1000, 5000, 100000})
+    {
+        for (int high : {3, 1000, INT_MAX})
+        {
+            vector<int> original = randomInts(n, high == INT_MAX ? INT_MIN : 0, high, static_cast<unsigned>(n));
+            vector<int> expected = original;
+            sort(expected.begin(), expected.end());
+
+            vector<int> counted = original;
+            CountingSorter::sort(counted, context);
+            require(counted == expected, "CountingSorter::sort is wrong for n=" + to_string(n));
+
+            if (n <= 5000)
+            {
+                vector<int> quick = original;
+                QuickSorter::sort(quick);
+                require(quick == expected, "QuickSorter::sort is wrong for n=" + to_string(n));
+            }
+
+            for (int target : {INT_MIN, -1, 0, 2, 500, INT_MAX})
+            {
+                int point = IterativeHalvingBinarySearcher::findInsertionPoint(expected, target);
+                require(point == lower_bound(expected.begin(), expected.end(), target) - expected.begin(),
+                        "findInsertionPoint is wrong for n=" + to_string(n));
+            }
+
+            vector<long long> wide(original.begin(), original.end());
+            vector<long long> serial(n);
+            vector<long long> parallel(n);
+            long long serialTotal = PrefixScanner::inclusiveScan(wide.data(), serial.data(), n);
+            long long parallelTotal = PrefixScanner::inclusiveScanParallel(wide.data(), parallel.data(), n, 4);
+            require(serial == parallel && serialTotal == parallelTotal, "parallel scan is wrong for n=" + to_string(n));
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    string path = argc > 1 ? argv[1] : TuningProfile::defaultPath();
+    unsigned threads = max(2u, thread::hardware_concurrency());
+
+    // Start from the defaults (nothing has been applied in this process, but be explicit about it)
+    TuningProfile().apply();
+
+    cout << "Calibrating on " << TuningProfile::hostName() << " (" << thread::hardware_concurrency()
+         << " hardware threads)\n";
+    cout << "  " << left << setw(26) << "setting" << setw(12) << "candidate" << right << setw(10) << "ms" << setw(10)
+         << "vs ms" << "\n";
+    cout << "  -------------------------------------------------------------\n";
+
+    TuningProfile calibrated;
+    try
+    {
+        calibrated.quickSortInsertionCutoff = calibrateInsertionCutoff();
+        calibrated.comparisonSortMaxSize = calibrateComparisonSortMax();
+        calibrated.countingRangeFactor = calibrateCountingRangeFactor();
+        calibrated.parallelGrain = calibrateParallelGrain(threads);
+        calibrated.linearScanMaxSize = calibrateLinearScan();
+
+        calibrated.apply();
+        checkAlgorithms();
+
+        calibrated.save(path, "written by Calibrator on host " + TuningProfile::hostName());
+        if (!(TuningProfile::load(path) == calibrated))
+        {
+            remove(path.c_str());
+            require(false, "profile read back from " + path + " differs");
+        }
+    }
+    catch (const runtime_error& error)
+    {
+        cerr << "\n" << error.what() << "\nNo profile written." << endl;
+        return 1;
+    }
+
+    cout << "\nProfile written to " << path << ":\n" << calibrated.toString();
+    cout << "\nVerified: calibrated thresholds keep every algorithm's results unchanged!" << endl;
+
+    return 0;
+}
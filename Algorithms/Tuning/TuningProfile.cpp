@@ -0,0 +1,92 @@
+#include <cassert>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#include <unistd.h>
+
+#include "TuningProfile.h"
+
+using namespace std;
+
+void writeFile(const string& path, const string& text)
+{
+    ofstream file(path);
+    file << text;
+}
+
+bool loadThrows(const string& path)
+{
+    try
+    {
+        TuningProfile::load(path);
+    }
+    catch (const runtime_error&)
+    {
+        return true;
+    }
+    return false;
+}
+
+int main()
+{
+    // Scratch files live in their own temporary directory, never next to a real profile
+    char directory[] = "/tmp/tuning-profile-XXXXXX";
+    if (mkdtemp(directory) == nullptr)
+    {
+        cerr << "cannot create a temporary directory" << endl;
+        return 1;
+    }
+    string path = string(directory) + "/test.profile";
+
+    // Example 1: save / load round trip
+    TuningProfile profile;
+    profile.quickSortInsertionCutoff = 24;
+    profile.parallelGrain = 131072;
+    profile.linearScanMaxSize = 0;
+    profile.save(path, "written by TuningProfile.cpp");
+
+    cout << "Example 1 - Saved profile\n";
+    cout << "-------------------------\n";
+    cout << profile.toString();
+    assert(TuningProfile::load(path) == profile);
+
+    // Comments, blank lines, spaces and unknown keys are skipped; missing keys keep their defaults
+    writeFile(path, "# hand-edited\n\n  parallelGrain = 4096  # per thread\nfutureSetting=7\n");
+    TuningProfile edited = TuningProfile::load(path);
+    assert(edited.parallelGrain == 4096);
+    assert(edited.quickSortInsertionCutoff == TuningProfile().quickSortInsertionCutoff);
+
+    // Malformed lines, overflowing numbers and out-of-range values all throw runtime_error
+    for (const char* text : {"linearScanMaxSize=eight\n", "parallelGrain\n", "parallelGrain=-5\n",
+                               "parallelGrain=99999999999999999999999\n", "parallelGrain=1\n",
+                               "quickSortInsertionCutoff=0\n", "countingRangeFactor=100000\n"})
+    {
+        writeFile(path, text);
+        assert(loadThrows(path));
+    }
+
+    // loadOrDefaults (what opting-in programs call): a broken file warns and falls back to the defaults
+    cout << "\nExample 2 - Broken profile\n";
+    cout << "--------------------------\n";
+    assert(TuningProfile::loadOrDefaults(path) == TuningProfile());
+
+    // A missing file gives the defaults
+    remove(path.c_str());
+    assert(TuningProfile::load(path) == TuningProfile());
+
+    // Nothing is applied until a program asks: the algorithms start on their constants, apply() hands over a profile
+    assert(TuningProfile::inEffect() == TuningProfile());
+    edited.apply();
+    assert(PrefixScanner::parallelGrain == 4096 && TuningProfile::inEffect() == edited);
+    TuningProfile().apply();
+    assert(PrefixScanner::parallelGrain == PrefixScanner::PARALLEL_GRAIN);
+    rmdir(directory);
+
+    cout << "\nAssertion passed: tuning profiles round-trip and bad files are rejected!" << endl;
+
+    return 0;
+}
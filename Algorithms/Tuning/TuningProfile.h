@@ -0,0 +1,235 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#define TUNING_PROFILE_POSIX 1
+#endif
+
+#include "../Prefix Sum/PrefixScanner.h"
+#include "../Searching/Binary Search/IterativeBinarySearcher.h"
+#include "../Sorting/Non-Comparison Element Count/CountingSorter.h"
+#include "../Sorting/Quick Sort/QuickSorter.h"
+
+using namespace std;
+
+/*
+    Tuning Profile (per-host algorithm thresholds):
+    - Every hybrid algorithm has a crossover point where one strategy starts beating another, and that point
+      moves with the hardware (cache sizes, branch predictor, core count, SIMD width)
+    - Each algorithm keeps its default as a plain constant next to a settable copy (e.g. QuickSorter::
+      INSERTION_SORT_CUTOFF and QuickSorter::insertionSortCutoff); the algorithm headers know nothing about files
+    - This header is the opt-in layer on top: the Calibrator (Tuning/Calibrator.cpp) measures the thresholds on
+      the machine and saves them, and a program that wants them calls apply() at the start of main:
+          TuningProfile::loadOrDefaults(TuningProfile::defaultPath()).apply();
+    - Programs that never include this header run on the defaults and never touch the file system
+
+    Decision points (profile key -> setting it applies to):
+        quickSortInsertionCutoff   QuickSorter::insertionSortCutoff: sub-arrays of at most this many elements use
+                                   insertion sort
+        parallelGrain              PrefixScanner::parallelGrain: minimum elements per thread before a scan goes parallel
+        comparisonSortMaxSize      CountingSorter::comparisonSortMaxSize: inputs of at most this many elements use
+                                   MergeSorter
+        countingRangeFactor        CountingSorter::countingRangeFactor: dense counting sort when
+                                   range <= max(factor * n, 1024), radix sort otherwise
+        linearScanMaxSize          IterativeHalvingBinarySearcher::linearScanMaxSize: findInsertionPoint windows of
+                                   at most this many elements are finished with a linear scan
+
+    File format (one `key=value` per line, '#' starts a comment, unknown keys are ignored):
+        # written by Calibrator on host build-07
+        quickSortInsertionCutoff=24
+        parallelGrain=131072
+
+    Location: $ALGORITHMS_TUNING_PROFILE if set, else $HOME/.algorithms-tuning-<hostname>.profile
+    - No file: the defaults are the algorithms' constants
+        * quickSortInsertionCutoff, comparisonSortMaxSize and linearScanMaxSize are switch points that did not
+          exist before profiles; 1, 0 and 0 respectively turn them off
+    - load() throws runtime_error for a malformed line or a value outside the field's allowed range
+      (e.g. parallelGrain below 1024 would hand out blocks too small to be worth a thread)
+    - loadOrDefaults() reports a broken file on stderr and returns the defaults: a bad dotfile must not stop
+      the program that opted in
+    - apply() writes plain process-wide settings: call it before other threads start sorting
+*/
+
+class TuningProfile
+{
+public:
+    size_t quickSortInsertionCutoff = QuickSorter::INSERTION_SORT_CUTOFF;
+    size_t parallelGrain = PrefixScanner::PARALLEL_GRAIN;
+    size_t comparisonSortMaxSize = CountingSorter::COMPARISON_SORT_MAX_SIZE;
+    size_t countingRangeFactor = CountingSorter::COUNTING_RANGE_FACTOR;
+    size_t linearScanMaxSize = IterativeHalvingBinarySearcher::LINEAR_SCAN_MAX_SIZE;
+
+    // The thresholds the algorithms are using right now
+    static TuningProfile inEffect()
+    {
+        TuningProfile profile;
+        profile.quickSortInsertionCutoff = QuickSorter::insertionSortCutoff;
+        profile.parallelGrain = PrefixScanner::parallelGrain;
+        profile.comparisonSortMaxSize = CountingSorter::comparisonSortMaxSize;
+        profile.countingRangeFactor = CountingSorter::countingRangeFactor;
+        profile.linearScanMaxSize = IterativeHalvingBinarySearcher::linearScanMaxSize;
+        return profile;
+    }
+
+    // Hands every threshold to its algorithm
+    void apply() const
+    {
+        QuickSorter::insertionSortCutoff = quickSortInsertionCutoff;
+        PrefixScanner::parallelGrain = parallelGrain;
+        CountingSorter::comparisonSortMaxSize = comparisonSortMaxSize;
+        CountingSorter::countingRangeFactor = countingRangeFactor;
+        IterativeHalvingBinarySearcher::linearScanMaxSize = linearScanMaxSize;
+    }
+
+    // load(), but a broken file gives the defaults plus a warning on stderr
+    static TuningProfile loadOrDefaults(const string& path)
+    {
+        try
+        {
+            return load(path);
+        }
+        catch (const runtime_error& error)
+        {
+            cerr << "warning: " << error.what() << "; using default thresholds" << endl;
+            return TuningProfile();
+        }
+    }
+
+    static string defaultPath()
+    {
+        const char* overridePath = getenv("ALGORITHMS_TUNING_PROFILE");
+        if (overridePath != nullptr && overridePath[0] != '\0') return overridePath;
+
+        const char* home = getenv("HOME");
+        return string(home != nullptr ? home : ".") + "/.algorithms-tuning-" + hostName() + ".profile";
+    }
+
+    static string hostName()
+    {
+#ifdef TUNING_PROFILE_POSIX
+        char name[256] = {};
+        if (gethostname(name, sizeof(name) - 1) == 0 && name[0] != '\0') return name;
+#else
+        const char* name = getenv("COMPUTERNAME"); // Windows
+        if (name != nullptr && name[0] != '\0') return name;
+#endif
+        return "localhost";
+    }
+
+    // Defaults overridden by every key found in the file; a missing file gives the defaults
+    static TuningProfile load(const string& path)
+    {
+        TuningProfile profile;
+
+        ifstream file(path);
+        if (!file) return profile;
+
+        string line;
+        int lineNumber = 0;
+        while (getline(file, line))
+        {
+            lineNumber++;
+
+            size_t comment = line.find('#');
+            if (comment != string::npos) line.erase(comment);
+
+            size_t equals = line.find('=');
+            if (equals == string::npos)
+            {
+                if (line.find_first_not_of(" \t\r") != string::npos) throw malformed(path, lineNumber);
+                continue;
+            }
+
+            string key = trim(line.substr(0, equals));
+            string value = trim(line.substr(equals + 1));
+
+            Field field = profile.fieldFor(key);
+            if (field.value == nullptr) continue;
+
+            if (value.empty() || value.find_first_not_of("0123456789") != string::npos) throw malformed(path, lineNumber);
+
+            unsigned long long parsed;
+            try
+            {
+                parsed = stoull(value);
+            }
+            catch (const exception&)
+            {
+                throw malformed(path, lineNumber); // more digits than fit
+            }
+
+            if (parsed < field.minimum || parsed > field.maximum)
+            {
+                throw runtime_error("TuningProfile: " + key + "=" + value + " outside [" + to_string(field.minimum) + ", " +
+                                    to_string(field.maximum) + "] on line " + to_string(lineNumber) + " in " + path);
+            }
+            *field.value = static_cast<size_t>(parsed);
+        }
+
+        return profile;
+    }
+
+    void save(const string& path, const string& comment = "") const
+    {
+        ofstream file(path);
+        if (!file) throw runtime_error("TuningProfile: cannot write " + path);
+
+        if (!comment.empty()) file << "# " << comment << "\n";
+        file << toString();
+
+        if (!file) throw runtime_error("TuningProfile: cannot write " + path);
+    }
+
+    string toString() const
+    {
+        return "quickSortInsertionCutoff=" + to_string(quickSortInsertionCutoff) + "\n" +
+               "parallelGrain=" + to_string(parallelGrain) + "\n" +
+               "comparisonSortMaxSize=" + to_string(comparisonSortMaxSize) + "\n" +
+               "countingRangeFactor=" + to_string(countingRangeFactor) + "\n" +
+               "linearScanMaxSize=" + to_string(linearScanMaxSize) + "\n";
+    }
+
+    bool operator==(const TuningProfile& other) const
+    {
+        return toString() == other.toString();
+    }
+
+private:
+    // A tunable threshold and the values load() accepts for it
+    struct Field
+    {
+        size_t* value;
+        unsigned long long minimum;
+        unsigned long long maximum;
+    };
+
+    Field fieldFor(const string& key)
+    {
+        if (key == "quickSortInsertionCutoff") return {&quickSortInsertionCutoff, 1, 1 << 12};
+        if (key == "parallelGrain") return {&parallelGrain, 1 << 10, 1ull << 40};
+        if (key == "comparisonSortMaxSize") return {&comparisonSortMaxSize, 0, 1 << 20};
+        if (key == "countingRangeFactor") return {&countingRangeFactor, 0, 1 << 10};
+        if (key == "linearScanMaxSize") return {&linearScanMaxSize, 0, 1 << 12};
+        return {nullptr, 0, 0};
+    }
+
+    static string trim(const string& text)
+    {
+        size_t first = text.find_first_not_of(" \t\r");
+        if (first == string::npos) return "";
+        size_t last = text.find_last_not_of(" \t\r");
+        return text.substr(first, last - first + 1);
+    }
+
+    static runtime_error malformed(const string& path, int lineNumber)
+    {
+        return runtime_error("TuningProfile: malformed line " + to_string(lineNumber) + " in " + path);
+    }
+};